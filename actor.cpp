@@ -3,20 +3,24 @@
 #include <cstdio>
 
 Actor::Actor(int tileX, int tileY, int tileSize, Direction initialDirection, int waitingPellets,
-             int inBaseTileX, int inBaseTileY, int speed)
+             int inBaseTileX, int inBaseTileY)
 {
   tileSize_ = tileSize;
   waitingPellets_ = waitingPellets;
-  speed_ = speed;
+  movement_ = 0;
+  lastMove_ = 0;
   direction_ = initialDirection;
   
   // Place actor at tile (x, y).
-  x_ = tileX * tileSize + (tileSize / 2);
-  y_ = tileY * tileSize;
+  x_ = (tileX * tileSize + (tileSize / 2)) * SUBPIXELS;
+  y_ = (tileY * tileSize) * SUBPIXELS;
   
   inBaseTileX_ = inBaseTileX;
   inBaseTileY_ = inBaseTileY;
   
+  scatterTileX_ = -1;
+  scatterTileY_ = -1;
+  
   startTileX_ = tileX;
   startTileY_ = tileY;
   
@@ -28,18 +32,41 @@ Actor::Actor(int tileX, int tileY, int tileSize, Direction initialDirection, int
   state_ = GHOST_NONE;
 }
 
-Actor::~Actor() {}
-
 int Actor::getX()
 {
-  return x_;
+  return x_ / SUBPIXELS;
 }
 
 int Actor::getY()
+{
+  return y_ / SUBPIXELS;
+}
+
+int Actor::getSubpixelX()
+{
+  return x_;
+}
+
+int Actor::getSubpixelY()
 {
   return y_;
 }
 
+bool Actor::isAt(int x, int y)
+{
+  return isAtX(x) && isAtY(y);
+}
+
+bool Actor::isAtX(int x)
+{
+  return x_ == x * SUBPIXELS;
+}
+
+bool Actor::isAtY(int y)
+{
+  return y_ == y * SUBPIXELS;
+}
+
 int Actor::getStartTileX()
 {
   return startTileX_;
@@ -82,12 +109,12 @@ int Actor::getTileOffsetY()
 
 void Actor::setTileX(int tileX)
 {
-  x_ = tileX * tileSize_;
+  x_ = tileX * tileSize_ * SUBPIXELS;
 }
 
 void Actor::setTileY(int tileY)
 {
-  y_ = tileY * tileSize_;
+  y_ = tileY * tileSize_ * SUBPIXELS;
 }
 
 int Actor::getTargetTileX()
@@ -130,11 +157,6 @@ void Actor::setWaitingPellets(int waitingPellets)
   waitingPellets_ = waitingPellets;
 }
 
-void Actor::setSpeed(int speed)
-{
-  speed_ = speed;
-}
-
 void Actor::turnAround()
 {
   if (direction_ == DIRECTION_UP) {
@@ -158,6 +180,22 @@ int Actor::getSpotInBaseY()
   return (inBaseTileY_ * tileSize_);
 }
 
+int Actor::getScatterTileX()
+{
+  return scatterTileX_;
+}
+
+int Actor::getScatterTileY()
+{
+  return scatterTileY_;
+}
+
+void Actor::setScatterTile(int tileX, int tileY)
+{
+  scatterTileX_ = tileX;
+  scatterTileY_ = tileY;
+}
+
 GHOST_STATE Actor::getState()
 {
   return state_;
@@ -178,30 +216,51 @@ void Actor::setPower(int power)
   power_ = power;
 }
 
+void Actor::startTick(int speed)
+{
+  // Only carry movement over from a tick that ended with a move, and
+  // never more than a tick's worth, so that an actor held up by a wall
+  // doesn't leap forward once free.
+  int carried = (lastMove_ > 0) ? movement_ : 0;
+  if (carried > speed) carried = speed;
+  movement_ = carried + speed;
+  lastMove_ = 0;
+}
+
 void Actor::moveForward()
 {
+  int position = (direction_ == DIRECTION_UP || direction_ == DIRECTION_DOWN) ? y_ : x_;
+  int distance = getDistanceToStop(position, direction_, tileSize_);
+  lastMove_ = (movement_ < distance) ? movement_ : distance;
+  movement_ -= lastMove_;
   if (direction_ == DIRECTION_UP) {
-    y_ -= speed_;
+    y_ -= lastMove_;
   } else if (direction_ == DIRECTION_DOWN) {
-    y_ += speed_;
+    y_ += lastMove_;
   } else if (direction_ == DIRECTION_LEFT) {
-    x_ -= speed_;
+    x_ -= lastMove_;
   } else if (direction_ == DIRECTION_RIGHT) {
-    x_ += speed_;
+    x_ += lastMove_;
+  } else {
+    // Not moving anywhere.
+    movement_ += lastMove_;
+    lastMove_ = 0;
   }
 }
 
 void Actor::moveBackward()
 {
   if (direction_ == DIRECTION_UP) {
-    y_ += speed_;
+    y_ += lastMove_;
   } else if (direction_ == DIRECTION_DOWN) {
-    y_ -= speed_;
+    y_ -= lastMove_;
   } else if (direction_ == DIRECTION_LEFT) {
-    x_ += speed_;
+    x_ += lastMove_;
   } else if (direction_ == DIRECTION_RIGHT) {
-    x_ -= speed_;
+    x_ -= lastMove_;
   }
+  movement_ += lastMove_;
+  lastMove_ = 0;
 }
 
 void Actor::printState()
@@ -10,7 +10,8 @@ typedef enum {
   GHOST_EATEN,
   GHOST_FRIGHTENED,
   GHOST_FINDING_SPOT,
-  GHOST_FINDING_EXIT
+  GHOST_FINDING_EXIT,
+  NUM_GHOST_STATES
 } GHOST_STATE;
 
 class Actor {
@@ -27,13 +28,30 @@ class Actor {
      * up both tiles (tileX, tileY) and (tileX + 1, tileY) completely.
      */
     Actor(int tileX, int tileY, int tileSize, Direction initialDirection, int waitingFrames = 0,
-          int inBaseTileX = 0, int inBaseTileY = 0, int speed = 3);
-    ~Actor();
+          int inBaseTileX = 0, int inBaseTileY = 0);
+    
+    // Left unset, to be copied over, e.g. from a SimulationState. Actors
+    // are plain values, so copying one copies everything about it.
+    Actor() = default;
+    
+    // Positions are kept in sub-pixels, SUBPIXELS to a pixel,
+    // so that actors can move by a fraction of a pixel per tick.
+    static const int SUBPIXELS = 256;
     
     // Where is this actor (the top left corner) in pixel space?
+    // Rounded down to a whole pixel, for drawing.
     int getX();
     int getY();
     
+    // Where is this actor (the top left corner) in sub-pixel space?
+    int getSubpixelX();
+    int getSubpixelY();
+    
+    // Is the top left corner of this actor exactly at this pixel?
+    bool isAt(int x, int y);
+    bool isAtX(int x);
+    bool isAtY(int y);
+    
     // Where is this actor's starting position in tile space?
     int getStartTileX();
     int getStartTileY();
@@ -54,8 +72,23 @@ class Actor {
     Direction getDirection();
     void setDirection(Direction direction);
 
-    // Move one frame in current direction.
+    /**
+     * Start a new tick, moving speed sub-pixels in it. Movement cut short
+     * on the last tick by reaching a stop (see moveForward()) is carried
+     * over, so that on average an actor moves exactly at its speed.
+     */
+    void startTick(int speed);
+    
+    /**
+     * Move in current direction by what is left of this tick's movement,
+     * but no further than the next stop: a point where the edge of the
+     * actor is lined up with the edge or the middle of a tile, every half
+     * a tile. Every place an actor can turn or change state is a stop, so
+     * reaching one is never missed by stepping over it, at any speed.
+     */
     void moveForward();
+    
+    // Undo the last moveForward(), giving its movement back.
     void moveBackward();
     
     /* For ghosts. */
@@ -65,6 +98,11 @@ class Actor {
     int getSpotInBaseX();
     int getSpotInBaseY();
     
+    // Which corner does this ghost head for in Scatter mode, in tile space?
+    int getScatterTileX();
+    int getScatterTileY();
+    void setScatterTile(int tileX, int tileY);
+    
     void setTargetTileX(int targetTileX);
     void setTargetTileY(int targetTileY);
     int getTargetTileX();
@@ -80,14 +118,12 @@ class Actor {
     int getWaitingPellets();
     void setWaitingPellets(int waitingPellets);
     
-    void setSpeed(int speed);
-    
     /* For PACMAN. */
     int getPower();
     void setPower(int powerFrames);
 
   private:
-    // Where is this actor (the top left corner) in pixel space?
+    // Where is this actor (the top left corner) in sub-pixel space?
     int x_;
     int y_;
     
@@ -98,8 +134,11 @@ class Actor {
     // Which direction is this actor facing?
     Direction direction_;
     
-    // Speed in pixels/frame.
-    int speed_;
+    // Sub-pixels left to move on this tick.
+    int movement_;
+    
+    // Sub-pixels moved by the last moveForward(), 0 if undone.
+    int lastMove_;
     
     int tileSize_;
     
@@ -113,6 +152,9 @@ class Actor {
     int inBaseTileX_;
     int inBaseTileY_;
     
+    int scatterTileX_;
+    int scatterTileY_;
+    
     int targetTileX_;
     int targetTileY_;
     
@@ -122,4 +164,20 @@ class Actor {
     int power_;
 };
 
+/**
+ * Sub-pixels from position, along the axis of the given direction, to the
+ * next stop ahead (see Actor::moveForward()) for actors of this tile size.
+ * Defined here so the batch engine's movement passes can inline it.
+ */
+inline int getDistanceToStop(int position, Direction direction, int tileSize)
+{
+  int stopSpacing = (tileSize / 2) * Actor::SUBPIXELS;
+  // How far past the last stop, from 0 up to stopSpacing - 1.
+  int offset = ((position % stopSpacing) + stopSpacing) % stopSpacing;
+  if (direction == DIRECTION_RIGHT || direction == DIRECTION_DOWN) {
+    return stopSpacing - offset;
+  }
+  return (offset == 0) ? stopSpacing : offset;
+}
+
 #endif /* actor_h */
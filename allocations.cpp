@@ -0,0 +1,32 @@
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+#include "allocations.h"
+
+// Never reset, so callers count by taking the difference of two readings.
+// Atomic, as Game allocates from both its render and simulation threads.
+static std::atomic<unsigned long> numAllocations(0);
+
+unsigned long getNumAllocations()
+{
+  return numAllocations.load(std::memory_order_relaxed);
+}
+
+void *operator new(size_t size)
+{
+  numAllocations.fetch_add(1, std::memory_order_relaxed);
+  void *memory = malloc((size == 0) ? 1 : size);
+  if (memory == NULL) throw std::bad_alloc();
+  return memory;
+}
+
+// new[] and delete[] forward to these by default.
+void operator delete(void *memory) noexcept
+{
+  free(memory);
+}
+
+void operator delete(void *memory, size_t) noexcept
+{
+  free(memory);
+}
@@ -0,0 +1,16 @@
+#ifndef allocations_h
+#define allocations_h
+
+/**
+ * Counts heap allocations made through operator new and new[], so that
+ * code which should never allocate (stepping the simulation, drawing a
+ * frame) can be checked. Linking in allocations.cpp replaces the global
+ * operator new and delete for the whole program.
+ *
+ * Only operator new is counted. Memory from malloc() directly, ours or
+ * SDL's, is invisible to it, so a check passing says nothing about
+ * malloc() calls.
+ */
+unsigned long getNumAllocations();
+
+#endif /* allocations_h */
@@ -0,0 +1,288 @@
+// atlasgen: cuts the sprites the game draws out of spritesheet.png, packs
+// them into one atlas, and writes it out as C++ to be built into the game:
+// sprites.h, naming every sprite and where it is in the atlas, and
+// sprites.cpp, holding the atlas's pixels. The game then needs no image
+// loading at startup.
+//
+// PACMAN is drawn facing four ways. Rather than turning the sprite when
+// drawing it, every way is cut out here already turned.
+//
+// Build and run, after changing spritesheet.png or the sprites below, with:
+//   cmake --build build --target atlasgen
+//   ./build/atlasgen spritesheet.png
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <png.h>
+
+// A sprite to cut out of the sprite sheet, turned clockwise by
+// a number of quarter turns.
+struct SpriteSource {
+  const char *name;
+  int x;
+  int y;
+  int size;
+  int quarterTurns;
+};
+
+static const SpriteSource SOURCES[] = {
+  // 48px sprites, drawn centred on a 24px actor.
+  { "PACMAN_STILL",          5 * 48, 48,      48, 0 },
+  { "PACMAN_UP_0",           4 * 48, 48,      48, 3 },
+  { "PACMAN_DOWN_0",         4 * 48, 48,      48, 1 },
+  { "PACMAN_LEFT_0",         4 * 48, 48,      48, 2 },
+  { "PACMAN_RIGHT_0",        4 * 48, 48,      48, 0 },
+  { "PACMAN_UP_1",           5 * 48, 48,      48, 3 },
+  { "PACMAN_DOWN_1",         5 * 48, 48,      48, 1 },
+  { "PACMAN_LEFT_1",         5 * 48, 48,      48, 2 },
+  { "PACMAN_RIGHT_1",        5 * 48, 48,      48, 0 },
+  { "GHOST_BLINKY",          0 * 48, 48,      48, 0 },
+  { "GHOST_INKY",            1 * 48, 48,      48, 0 },
+  { "GHOST_PINKY",           2 * 48, 48,      48, 0 },
+  { "GHOST_CLYDE",           3 * 48, 48,      48, 0 },
+  { "GHOST_FRIGHTENED",      0 * 48, 0,       48, 0 },
+  { "GHOST_FRIGHTENED_FLASH", 1 * 48, 2 * 48, 48, 0 },
+  { "EYES_UP",               1 * 48, 0,       48, 0 },
+  { "EYES_DOWN",             2 * 48, 0,       48, 0 },
+  { "EYES_LEFT",             3 * 48, 0,       48, 0 },
+  { "EYES_RIGHT",            4 * 48, 0,       48, 0 },
+
+  // 24px sprites, one tile each.
+  { "TARGET_BLINKY",         0,               2 * 48,      24, 0 },
+  { "TARGET_INKY",           24,              2 * 48,      24, 0 },
+  { "TARGET_PINKY",          0,               (2 * 48) + 24, 24, 0 },
+  { "TARGET_CLYDE",          24,              (2 * 48) + 24, 24, 0 },
+  { "PELLET",                5 * 48,          0,           24, 0 },
+  { "POWER_PELLET_0",        (5 * 48) + 24,   0,           24, 0 },
+  { "POWER_PELLET_1",        (5 * 48) + 24,   24,          24, 0 },
+  { "GATE",                  5 * 48,          24,          24, 0 },
+  { "WALL_TOP_LEFT",         6 * 48,          0,           24, 0 },
+  { "WALL_TOP_RIGHT",        (6 * 48) + 24,   0,           24, 0 },
+  { "WALL_BOT_LEFT",         6 * 48,          24,          24, 0 },
+  { "WALL_BOT_RIGHT",        (6 * 48) + 24,   24,          24, 0 },
+  { "WALL_LEFT_RIGHT",       7 * 48,          24,          24, 0 },
+  { "WALL_TOP_BOT",          7 * 48,          0,           24, 0 },
+};
+
+static const int NUM_SOURCES = sizeof(SOURCES) / sizeof(SOURCES[0]);
+
+// Sprites are packed left to right in rows, each row as tall as
+// its tallest sprite, so the atlas is this wide.
+static const int ATLAS_WIDTH = 8 * 48;
+
+// Where each sprite ended up in the atlas.
+struct SpriteRect {
+  int x;
+  int y;
+  int w;
+  int h;
+};
+
+// Pixel (x, y) of a size x size block at (blockX, blockY) of the sheet,
+// as seen after turning the block clockwise by quarterTurns.
+static uint32_t getTurnedPixel(const uint32_t *sheet, int sheetWidth,
+                               int blockX, int blockY, int size, int quarterTurns,
+                               int x, int y)
+{
+  int sourceX = x;
+  int sourceY = y;
+  switch (quarterTurns % 4) {
+    case 1:
+      // The top row of the source becomes the right column.
+      sourceX = y;
+      sourceY = size - 1 - x;
+      break;
+    case 2:
+      sourceX = size - 1 - x;
+      sourceY = size - 1 - y;
+      break;
+    case 3:
+      sourceX = size - 1 - y;
+      sourceY = x;
+      break;
+    default:
+      break;
+  }
+  return sheet[((blockY + sourceY) * sheetWidth) + blockX + sourceX];
+}
+
+static bool writeHeader(const char *path, const SpriteRect *rects, int atlasHeight)
+{
+  FILE *file = fopen(path, "w");
+  if (file == NULL) {
+    printf("Unable to open '%s' for writing!\n", path);
+    return false;
+  }
+  fprintf(file,
+          "// Generated by atlasgen from spritesheet.png. Do not edit.\n"
+          "\n"
+          "#ifndef sprites_h\n"
+          "#define sprites_h\n"
+          "\n"
+          "#include <stdint.h>\n"
+          "\n"
+          "// Every sprite in the atlas.\n"
+          "typedef enum {\n");
+  for (int i = 0; i < NUM_SOURCES; i++) {
+    fprintf(file, "  SPRITE_%s,\n", SOURCES[i].name);
+  }
+  fprintf(file,
+          "  NUM_SPRITES\n"
+          "} SpriteId;\n"
+          "\n"
+          "struct SpriteRect {\n"
+          "  int x;\n"
+          "  int y;\n"
+          "  int w;\n"
+          "  int h;\n"
+          "};\n"
+          "\n"
+          "constexpr int ATLAS_WIDTH = %d;\n"
+          "constexpr int ATLAS_HEIGHT = %d;\n"
+          "\n"
+          "// Where each sprite is in the atlas, by SpriteId.\n"
+          "constexpr SpriteRect SPRITE_RECTS[NUM_SPRITES] = {\n",
+          ATLAS_WIDTH, atlasHeight);
+  for (int i = 0; i < NUM_SOURCES; i++) {
+    fprintf(file, "  { %d, %d, %d, %d }%s // SPRITE_%s\n",
+            rects[i].x, rects[i].y, rects[i].w, rects[i].h,
+            (i + 1 < NUM_SOURCES) ? "," : " ", SOURCES[i].name);
+  }
+  fprintf(file,
+          "};\n"
+          "\n"
+          "// The atlas, row by row, as SDL_PIXELFORMAT_RGBA8888.\n"
+          "extern const uint32_t ATLAS_PIXELS[ATLAS_WIDTH * ATLAS_HEIGHT];\n"
+          "\n"
+          "#endif /* sprites_h */\n");
+  bool success = !ferror(file);
+  if (fclose(file) != 0) success = false;
+  if (!success) printf("Failed to write '%s'!\n", path);
+  return success;
+}
+
+static bool writePixels(const char *path, const uint32_t *atlas, int atlasHeight)
+{
+  FILE *file = fopen(path, "w");
+  if (file == NULL) {
+    printf("Unable to open '%s' for writing!\n", path);
+    return false;
+  }
+  fprintf(file,
+          "// Generated by atlasgen from spritesheet.png. Do not edit.\n"
+          "\n"
+          "#include \"sprites.h\"\n"
+          "\n"
+          "const uint32_t ATLAS_PIXELS[ATLAS_WIDTH * ATLAS_HEIGHT] = {\n");
+  int numPixels = ATLAS_WIDTH * atlasHeight;
+  for (int i = 0; i < numPixels; i++) {
+    // Mostly transparent, so keep those short.
+    if (atlas[i] == 0) {
+      fprintf(file, "0,");
+    } else {
+      fprintf(file, "0x%08x,", atlas[i]);
+    }
+    if ((i % 16) == 15 || i + 1 == numPixels) fputc('\n', file);
+  }
+  fprintf(file, "};\n");
+  bool success = !ferror(file);
+  if (fclose(file) != 0) success = false;
+  if (!success) printf("Failed to write '%s'!\n", path);
+  return success;
+}
+
+int main(int argc, char *argv[])
+{
+  if (argc != 2) {
+    printf("Usage: %s spritesheet.png\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  // Read the sheet as RGBA8888, the format the atlas is written in.
+  png_image image;
+  memset(&image, 0, sizeof(image));
+  image.version = PNG_IMAGE_VERSION;
+  if (!png_image_begin_read_from_file(&image, argv[1])) {
+    printf("Unable to read '%s'! %s\n", argv[1], image.message);
+    return EXIT_FAILURE;
+  }
+  image.format = PNG_FORMAT_RGBA;
+  int sheetWidth = (int)image.width;
+  int sheetHeight = (int)image.height;
+  uint8_t *bytes = (uint8_t *)malloc(PNG_IMAGE_SIZE(image));
+  uint32_t *sheet = (uint32_t *)malloc(sheetWidth * sheetHeight * sizeof(uint32_t));
+  if (bytes == NULL || sheet == NULL) {
+    printf("Failed to allocate memory for the sprite sheet!\n");
+    return EXIT_FAILURE;
+  }
+  if (!png_image_finish_read(&image, NULL, bytes, 0, NULL)) {
+    printf("Unable to read '%s'! %s\n", argv[1], image.message);
+    return EXIT_FAILURE;
+  }
+  for (int i = 0; i < sheetWidth * sheetHeight; i++) {
+    uint8_t *pixel = &bytes[i * 4];
+    sheet[i] = ((uint32_t)pixel[0] << 24) | ((uint32_t)pixel[1] << 16) |
+               ((uint32_t)pixel[2] << 8) | (uint32_t)pixel[3];
+  }
+  free(bytes);
+
+  // Pack the sprites, in order.
+  SpriteRect rects[NUM_SOURCES];
+  int x = 0;
+  int y = 0;
+  int rowHeight = 0;
+  for (int i = 0; i < NUM_SOURCES; i++) {
+    const SpriteSource *source = &SOURCES[i];
+    if (source->x < 0 || source->y < 0 || source->x + source->size > sheetWidth ||
+        source->y + source->size > sheetHeight || source->size > ATLAS_WIDTH) {
+      printf("Sprite %s is off the sprite sheet!\n", source->name);
+      return EXIT_FAILURE;
+    }
+    if (x + source->size > ATLAS_WIDTH) {
+      x = 0;
+      y += rowHeight;
+      rowHeight = 0;
+    }
+    rects[i] = { x, y, source->size, source->size };
+    x += source->size;
+    if (source->size > rowHeight) rowHeight = source->size;
+  }
+  int atlasHeight = y + rowHeight;
+
+  uint32_t *atlas = (uint32_t *)calloc(ATLAS_WIDTH * atlasHeight, sizeof(uint32_t));
+  if (atlas == NULL) {
+    printf("Failed to allocate memory for the atlas!\n");
+    return EXIT_FAILURE;
+  }
+  for (int i = 0; i < NUM_SOURCES; i++) {
+    const SpriteSource *source = &SOURCES[i];
+    for (int j = 0; j < source->size; j++) {
+      for (int k = 0; k < source->size; k++) {
+        uint32_t pixel = getTurnedPixel(
+          sheet, sheetWidth, source->x, source->y, source->size, source->quarterTurns, k, j);
+        // Rasterizer only copies pixels or skips them, so a sprite can't
+        // be partly see-through anywhere, or it would be drawn differently
+        // from how SDL blends it.
+        uint8_t alpha = pixel & 0xFF;
+        if (alpha != 0 && alpha != 0xFF) {
+          printf("Sprite %s has a partly transparent pixel, with alpha %d!\n", source->name, alpha);
+          free(atlas);
+          free(sheet);
+          return EXIT_FAILURE;
+        }
+        atlas[((rects[i].y + j) * ATLAS_WIDTH) + rects[i].x + k] = pixel;
+      }
+    }
+  }
+
+  bool success = writeHeader("sprites.h", rects, atlasHeight) &&
+                 writePixels("sprites.cpp", atlas, atlasHeight);
+  if (success) {
+    printf("Packed %d sprites into a %dx%d atlas.\n", NUM_SOURCES, ATLAS_WIDTH, atlasHeight);
+  }
+  free(atlas);
+  free(sheet);
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,845 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <new>
+#include "batch.h"
+#include "board.h"
+#include "targeting.h"
+
+static const int TILE_SIZE = Simulation::TILE_SIZE;
+
+// Tile sizes in the sub-pixels positions are kept in.
+static const int TILE_SUBPIXELS = TILE_SIZE * Actor::SUBPIXELS;
+static const int HALF_TILE_SUBPIXELS = TILE_SUBPIXELS / 2;
+
+// Tiles that stop PACMAN, and that stop ghosts, as bit masks of TileType.
+static const int PACMAN_BLOCKERS = (1 << TILE_WALL) | (1 << TILE_GATE);
+static const int GHOST_BLOCKERS = (1 << TILE_WALL);
+static const int GHOST_OUTSIDE_BLOCKERS = (1 << TILE_WALL) | (1 << TILE_GATE);
+
+// Allocate size bytes, unless an earlier allocation already failed.
+static void *allocate(size_t size, bool *success)
+{
+  if (!*success) return NULL;
+  void *memory = malloc(size);
+  if (memory == NULL) {
+    printf("Failed to allocate memory for batch of games!\n");
+    *success = false;
+  }
+  return memory;
+}
+
+BatchSimulation::BatchSimulation(int numGames, int ticksPerSecond, Level *level)
+{
+  numGames_ = numGames;
+  ticksPerSecond_ = ticksPerSecond;
+  startTiles_ = NULL;
+  tiles_ = NULL;
+  for (int slot = 0; slot < NUM_SLOTS; slot++) {
+    x_[slot] = NULL;
+    y_[slot] = NULL;
+    direction_[slot] = NULL;
+    state_[slot] = NULL;
+    waitingPellets_[slot] = NULL;
+    movement_[slot] = NULL;
+    lastMove_[slot] = NULL;
+  }
+  power_ = NULL;
+  pellets_ = NULL;
+  isGameOver_ = NULL;
+  isGameOverWin_ = NULL;
+  isFrightenedFlashing_ = NULL;
+  currentMode_ = NULL;
+  currentModeIndex_ = NULL;
+  isModeTimerRunning_ = NULL;
+  modeTicks_ = NULL;
+  random_ = NULL;
+  isActive_ = NULL;
+  hasPacmanMoved_ = NULL;
+  hasPowerRunOut_ = NULL;
+  trialDirection_ = NULL;
+  trialX_ = NULL;
+  trialY_ = NULL;
+  trialMove_ = NULL;
+  isBlocked_ = NULL;
+  targetX_ = NULL;
+  targetY_ = NULL;
+
+  success_ = false;
+
+  bool success = true;
+
+  if (numGames < 1) {
+    printf("A batch needs at least one game!\n");
+    success = false;
+  }
+
+  // Take the level, and where everything starts on it, from a Simulation,
+  // so there is only one place the level is loaded.
+  Simulation *prototype = NULL;
+  if (success) {
+    prototype = new (std::nothrow) Simulation(ticksPerSecond, 1, level);
+    if (prototype == NULL || !prototype->getSuccess()) {
+      printf("Simulation initialisation failed!\n");
+      success = false;
+    }
+  }
+  if (success) {
+    boardWidth_ = prototype->getBoardWidth();
+    boardHeight_ = prototype->getBoardHeight();
+    stride_ = boardWidth_ + 2;
+    gridSize_ = stride_ * (boardHeight_ + 2);
+    startTiles_ = (uint8_t *)allocate(gridSize_, &success);
+  }
+  Board board;
+  if (success && !board.init(boardWidth_, boardHeight_)) {
+    success = false;
+  }
+  if (success) {
+    // Walls all around, same as the simulation.
+    for (int y = -1; y <= boardHeight_; y++) {
+      for (int x = -1; x <= boardWidth_; x++) {
+        startTiles_[((y + 1) * stride_) + x + 1] = (uint8_t)prototype->getTile(x, y);
+      }
+    }
+    // Portals pair up in the order the simulation finds them.
+    portalOneX_ = portalOneY_ = portalTwoX_ = portalTwoY_ = -1;
+    for (int y = 0; y < boardHeight_; y++) {
+      for (int x = 0; x < boardWidth_; x++) {
+        TileType tile = prototype->getTile(x, y);
+        board.setTile(x, y, tile);
+        if (tile != TILE_PORTAL) continue;
+        if (portalOneX_ == -1) {
+          portalOneX_ = x;
+          portalOneY_ = y;
+        } else {
+          portalTwoX_ = x;
+          portalTwoY_ = y;
+        }
+      }
+    }
+    totalPellets_ = prototype->getTotalPellets();
+    tunnelOneEndX_ = -1;
+    tunnelTwoEndX_ = -1;
+    if (portalOneX_ != -1 && portalTwoX_ != -1) {
+      tunnelOneEndX_ = portalOneX_;
+      while (prototype->getTile(tunnelOneEndX_ + 1, portalOneY_) == TILE_NONE) tunnelOneEndX_++;
+      tunnelTwoEndX_ = portalTwoX_;
+      while (prototype->getTile(tunnelTwoEndX_ - 1, portalTwoY_) == TILE_NONE) tunnelTwoEndX_--;
+    }
+
+    Actor *actors[NUM_SLOTS] = {
+      prototype->getPacman(), prototype->getBlinky(), prototype->getInky(),
+      prototype->getPinky(), prototype->getClyde()
+    };
+    for (int slot = 0; slot < NUM_SLOTS; slot++) {
+      startX_[slot] = actors[slot]->getSubpixelX();
+      startY_[slot] = actors[slot]->getSubpixelY();
+      startDirection_[slot] = actors[slot]->getDirection();
+      startWaitingPellets_[slot] = actors[slot]->getWaitingPellets();
+      spotX_[slot] = actors[slot]->getSpotInBaseX() * Actor::SUBPIXELS;
+      spotY_[slot] = actors[slot]->getSpotInBaseY() * Actor::SUBPIXELS;
+      scatterX_[slot] = actors[slot]->getScatterTileX();
+      scatterY_[slot] = actors[slot]->getScatterTileY();
+    }
+    gateTileX_ = actors[SLOT_BLINKY]->getStartTileX();
+    gateTileY_ = actors[SLOT_BLINKY]->getStartTileY();
+    gateX_ = (gateTileX_ * TILE_SUBPIXELS) + HALF_TILE_SUBPIXELS;
+    gateY_ = gateTileY_ * TILE_SUBPIXELS;
+
+    powerTicks_ = (6000 * ticksPerSecond_) / 1000;
+    int flashMs[6] = { 1500, 1250, 1000, 750, 500, 250 };
+    for (int i = 0; i < 6; i++) flashTicks_[i] = (flashMs[i] * ticksPerSecond_) / 1000;
+
+    // Speeds in sub-pixels per tick, worked out as Simulation does.
+    int perTick = 100 * ticksPerSecond_;
+    int fullSpeed = Simulation::FULL_SPEED * Actor::SUBPIXELS;
+    pacmanSpeed_ = (fullSpeed * Simulation::PACMAN_SPEED) / perTick;
+    pacmanPowerSpeed_ = (fullSpeed * Simulation::PACMAN_POWER_SPEED) / perTick;
+    ghostTunnelSpeed_ = (fullSpeed * Simulation::GHOST_TUNNEL_SPEED) / perTick;
+    for (int i = 0; i < NUM_GHOST_STATES; i++) {
+      ghostSpeeds_[i] = (fullSpeed * Simulation::GHOST_SPEEDS[i]) / perTick;
+    }
+  }
+  if (prototype != NULL) delete prototype;
+
+  if (success && !tileExits_.init(&board)) {
+    success = false;
+  }
+
+  // State of every game.
+  size_t n = (size_t)numGames_;
+  if (success) tiles_ = (uint8_t *)allocate(n * gridSize_, &success);
+  for (int slot = 0; slot < NUM_SLOTS; slot++) {
+    x_[slot] = (int *)allocate(n * sizeof(int), &success);
+    y_[slot] = (int *)allocate(n * sizeof(int), &success);
+    direction_[slot] = (uint8_t *)allocate(n, &success);
+    state_[slot] = (uint8_t *)allocate(n, &success);
+    waitingPellets_[slot] = (int *)allocate(n * sizeof(int), &success);
+    movement_[slot] = (int *)allocate(n * sizeof(int), &success);
+    lastMove_[slot] = (int *)allocate(n * sizeof(int), &success);
+  }
+  power_ = (int *)allocate(n * sizeof(int), &success);
+  pellets_ = (int *)allocate(n * sizeof(int), &success);
+  isGameOver_ = (uint8_t *)allocate(n, &success);
+  isGameOverWin_ = (uint8_t *)allocate(n, &success);
+  isFrightenedFlashing_ = (uint8_t *)allocate(n, &success);
+  currentMode_ = (uint8_t *)allocate(n, &success);
+  currentModeIndex_ = (int *)allocate(n * sizeof(int), &success);
+  isModeTimerRunning_ = (uint8_t *)allocate(n, &success);
+  modeTicks_ = (int *)allocate(n * sizeof(int), &success);
+  if (success) {
+    random_ = new (std::nothrow) Random[n];
+    if (random_ == NULL) {
+      printf("Failed to allocate memory for batch of games!\n");
+      success = false;
+    }
+  }
+
+  // Scratch space.
+  isActive_ = (uint8_t *)allocate(n, &success);
+  hasPacmanMoved_ = (uint8_t *)allocate(n, &success);
+  hasPowerRunOut_ = (uint8_t *)allocate(n, &success);
+  trialDirection_ = (uint8_t *)allocate(n, &success);
+  trialX_ = (int *)allocate(n * sizeof(int), &success);
+  trialY_ = (int *)allocate(n * sizeof(int), &success);
+  trialMove_ = (int *)allocate(n * sizeof(int), &success);
+  isBlocked_ = (uint8_t *)allocate(n, &success);
+  targetX_ = (int *)allocate(n * sizeof(int), &success);
+  targetY_ = (int *)allocate(n * sizeof(int), &success);
+
+  if (success) {
+    for (int game = 0; game < numGames_; game++) {
+      reset(game, game + 1);
+    }
+  }
+
+  // Set to let caller know that initialisation succeeded.
+  success_ = success;
+}
+
+BatchSimulation::~BatchSimulation()
+{
+  if (startTiles_ != NULL) free(startTiles_);
+  if (tiles_ != NULL) free(tiles_);
+  for (int slot = 0; slot < NUM_SLOTS; slot++) {
+    if (x_[slot] != NULL) free(x_[slot]);
+    if (y_[slot] != NULL) free(y_[slot]);
+    if (direction_[slot] != NULL) free(direction_[slot]);
+    if (state_[slot] != NULL) free(state_[slot]);
+    if (waitingPellets_[slot] != NULL) free(waitingPellets_[slot]);
+    if (movement_[slot] != NULL) free(movement_[slot]);
+    if (lastMove_[slot] != NULL) free(lastMove_[slot]);
+  }
+  if (power_ != NULL) free(power_);
+  if (pellets_ != NULL) free(pellets_);
+  if (isGameOver_ != NULL) free(isGameOver_);
+  if (isGameOverWin_ != NULL) free(isGameOverWin_);
+  if (isFrightenedFlashing_ != NULL) free(isFrightenedFlashing_);
+  if (currentMode_ != NULL) free(currentMode_);
+  if (currentModeIndex_ != NULL) free(currentModeIndex_);
+  if (isModeTimerRunning_ != NULL) free(isModeTimerRunning_);
+  if (modeTicks_ != NULL) free(modeTicks_);
+  if (random_ != NULL) delete[] random_;
+  if (isActive_ != NULL) free(isActive_);
+  if (hasPacmanMoved_ != NULL) free(hasPacmanMoved_);
+  if (hasPowerRunOut_ != NULL) free(hasPowerRunOut_);
+  if (trialDirection_ != NULL) free(trialDirection_);
+  if (trialX_ != NULL) free(trialX_);
+  if (trialY_ != NULL) free(trialY_);
+  if (trialMove_ != NULL) free(trialMove_);
+  if (isBlocked_ != NULL) free(isBlocked_);
+  if (targetX_ != NULL) free(targetX_);
+  if (targetY_ != NULL) free(targetY_);
+}
+
+bool BatchSimulation::getSuccess()
+{
+  return success_;
+}
+
+int BatchSimulation::getNumGames()
+{
+  return numGames_;
+}
+
+int BatchSimulation::getTicksPerSecond()
+{
+  return ticksPerSecond_;
+}
+
+void BatchSimulation::reset(int game, uint32_t seed)
+{
+  memcpy(&tiles_[game * gridSize_], startTiles_, gridSize_);
+  for (int slot = 0; slot < NUM_SLOTS; slot++) {
+    x_[slot][game] = startX_[slot];
+    y_[slot][game] = startY_[slot];
+    direction_[slot][game] = (uint8_t)startDirection_[slot];
+    state_[slot][game] = GHOST_NONE;
+    waitingPellets_[slot][game] = startWaitingPellets_[slot];
+    movement_[slot][game] = 0;
+    lastMove_[slot][game] = 0;
+  }
+  power_[game] = 0;
+  pellets_[game] = 0;
+  isGameOver_[game] = false;
+  isGameOverWin_[game] = false;
+  isFrightenedFlashing_[game] = false;
+  currentMode_[game] = false;
+  currentModeIndex_[game] = 0;
+  isModeTimerRunning_[game] = false;
+  modeTicks_[game] = 0;
+  random_[game].setSeed(seed);
+}
+
+void BatchSimulation::step(const Direction *directions)
+{
+  // A game that is over at the start of a tick stays as it is,
+  // but a game that ends part way through a tick finishes it.
+  for (int i = 0; i < numGames_; i++) {
+    isActive_[i] = !isGameOver_[i];
+  }
+
+  movePacman(directions);
+  eatPellets();
+  collidePacmanWithGhosts();
+  updateModes();
+  findTargets<BlinkyTargeting>(SLOT_BLINKY);
+  moveGhosts(SLOT_BLINKY);
+  findTargets<InkyTargeting>(SLOT_INKY);
+  moveGhosts(SLOT_INKY);
+  findTargets<PinkyTargeting>(SLOT_PINKY);
+  moveGhosts(SLOT_PINKY);
+  findTargets<ClydeTargeting>(SLOT_CLYDE);
+  moveGhosts(SLOT_CLYDE);
+  drainPower();
+}
+
+void BatchSimulation::movePacman(const Direction *directions)
+{
+  int *x = x_[SLOT_PACMAN];
+  int *y = y_[SLOT_PACMAN];
+  uint8_t *direction = direction_[SLOT_PACMAN];
+  int *movement = movement_[SLOT_PACMAN];
+  int *lastMove = lastMove_[SLOT_PACMAN];
+
+  // Start the tick, as Actor::startTick(), a little faster with power.
+  for (int i = 0; i < numGames_; i++) {
+    int speed = (power_[i] > 0) ? pacmanPowerSpeed_ : pacmanSpeed_;
+    int carried = (lastMove[i] > 0) ? movement[i] : 0;
+    carried = (carried > speed) ? speed : carried;
+    movement[i] = isActive_[i] ? carried + speed : movement[i];
+    lastMove[i] = isActive_[i] ? 0 : lastMove[i];
+  }
+
+  // Try to move in the direction asked for, or on in
+  // the current direction if no direction was asked for.
+  for (int i = 0; i < numGames_; i++) {
+    int trial = (directions[i] == DIRECTION_NONE) ? (Direction)direction[i] : directions[i];
+    trialDirection_[i] = (uint8_t)trial;
+  }
+  setPacmanTrials();
+  for (int i = 0; i < numGames_; i++) {
+    isBlocked_[i] = isPacmanBlocked(i, trialX_[i], trialY_[i]);
+  }
+
+  // Where the new direction is blocked, try again on in the old direction.
+  for (int i = 0; i < numGames_; i++) {
+    int isRetrying = isBlocked_[i] && directions[i] != DIRECTION_NONE;
+    trialDirection_[i] = isRetrying ? direction[i] : trialDirection_[i];
+  }
+  setPacmanTrials();
+  for (int i = 0; i < numGames_; i++) {
+    if (isBlocked_[i] && directions[i] != DIRECTION_NONE) {
+      isBlocked_[i] = isPacmanBlocked(i, trialX_[i], trialY_[i]);
+    }
+  }
+
+  // Keep the moves that weren't blocked.
+  for (int i = 0; i < numGames_; i++) {
+    int hasMoved = isActive_[i] && !isBlocked_[i];
+    x[i] = hasMoved ? trialX_[i] : x[i];
+    y[i] = hasMoved ? trialY_[i] : y[i];
+    movement[i] -= hasMoved ? trialMove_[i] : 0;
+    lastMove[i] = hasMoved ? trialMove_[i] : lastMove[i];
+    direction[i] = isActive_[i] ? trialDirection_[i] : direction[i];
+    hasPacmanMoved_[i] = (uint8_t)hasMoved;
+  }
+}
+
+void BatchSimulation::setPacmanTrials()
+{
+  // Where PACMAN would be after moving forward in trialDirection_.
+  int *x = x_[SLOT_PACMAN];
+  int *y = y_[SLOT_PACMAN];
+  int *movement = movement_[SLOT_PACMAN];
+  for (int i = 0; i < numGames_; i++) {
+    int trial = trialDirection_[i];
+    int dx = (trial == DIRECTION_RIGHT) - (trial == DIRECTION_LEFT);
+    int dy = (trial == DIRECTION_DOWN) - (trial == DIRECTION_UP);
+    int position = (dy != 0) ? y[i] : x[i];
+    int distance = getDistanceToStop(position, (Direction)trial, TILE_SIZE);
+    int move = (movement[i] < distance) ? movement[i] : distance;
+    move = (trial == DIRECTION_NONE) ? 0 : move;
+    trialMove_[i] = move;
+    trialX_[i] = x[i] + (move * dx);
+    trialY_[i] = y[i] + (move * dy);
+  }
+}
+
+void BatchSimulation::eatPellets()
+{
+  int *x = x_[SLOT_PACMAN];
+  int *y = y_[SLOT_PACMAN];
+  for (int i = 0; i < numGames_; i++) {
+    if (!hasPacmanMoved_[i]) continue;
+
+    // The one, two or four tiles PACMAN is overlapping.
+    int firstTileX = x[i] / TILE_SUBPIXELS;
+    int firstTileY = y[i] / TILE_SUBPIXELS;
+    int lastTileX = (x[i] + TILE_SUBPIXELS - 1) / TILE_SUBPIXELS;
+    int lastTileY = (y[i] + TILE_SUBPIXELS - 1) / TILE_SUBPIXELS;
+    for (int tileX = firstTileX; tileX <= lastTileX; tileX++) {
+      for (int tileY = firstTileY; tileY <= lastTileY; tileY++) {
+        uint8_t *tile = &tiles_[getTileIndex(i, tileX, tileY)];
+        if (*tile == TILE_PELLET) {
+          *tile = TILE_NONE;
+          pellets_[i]++;
+          for (int slot = SLOT_BLINKY; slot <= SLOT_CLYDE; slot++) {
+            if (waitingPellets_[slot][i] > 0) waitingPellets_[slot][i]--;
+          }
+          if (pellets_[i] == totalPellets_) {
+            // PACMAN has collected all pellets.
+            gameOver(i, true);
+          }
+        } else if (*tile == TILE_POWER_PELLET) {
+          *tile = TILE_NONE;
+          power_[i] = powerTicks_;
+          for (int slot = SLOT_BLINKY; slot <= SLOT_CLYDE; slot++) {
+            if (state_[slot][i] == GHOST_CHASE || state_[slot][i] == GHOST_SCATTER) {
+              state_[slot][i] = GHOST_FRIGHTENED;
+              isFrightenedFlashing_[i] = false;
+              direction_[slot][i] = (uint8_t)getOppositeDirection((Direction)direction_[slot][i]);
+            }
+          }
+        } else if (*tile == TILE_PORTAL &&
+                   x[i] == tileX * TILE_SUBPIXELS && y[i] == tileY * TILE_SUBPIXELS) {
+          // Exactly in a portal. Only then is PACMAN overlapping
+          // just this one tile, so the loop ends here.
+          if (tileX == portalOneX_ && tileY == portalOneY_) {
+            x[i] = portalTwoX_ * TILE_SUBPIXELS;
+            y[i] = portalTwoY_ * TILE_SUBPIXELS;
+            direction_[SLOT_PACMAN][i] = DIRECTION_LEFT;
+          } else {
+            x[i] = portalOneX_ * TILE_SUBPIXELS;
+            y[i] = portalOneY_ * TILE_SUBPIXELS;
+            direction_[SLOT_PACMAN][i] = DIRECTION_RIGHT;
+          }
+        }
+      }
+    }
+  }
+}
+
+void BatchSimulation::collidePacmanWithGhosts()
+{
+  for (int slot = SLOT_BLINKY; slot <= SLOT_CLYDE; slot++) {
+    for (int i = 0; i < numGames_; i++) {
+      int isColliding = hasPacmanMoved_[i] &&
+        (x_[SLOT_PACMAN][i] + HALF_TILE_SUBPIXELS) / TILE_SUBPIXELS == (x_[slot][i] + HALF_TILE_SUBPIXELS) / TILE_SUBPIXELS &&
+        (y_[SLOT_PACMAN][i] + HALF_TILE_SUBPIXELS) / TILE_SUBPIXELS == (y_[slot][i] + HALF_TILE_SUBPIXELS) / TILE_SUBPIXELS;
+      if (!isColliding || state_[slot][i] == GHOST_EATEN) continue;
+      // PACMAN survives only if the ghost is Frightened,
+      // AND if PACMAN has remaining power left to eat it.
+      if (state_[slot][i] == GHOST_FRIGHTENED && power_[i] > 0) {
+        state_[slot][i] = GHOST_EATEN;
+      } else {
+        gameOver(i, false);
+      }
+    }
+  }
+}
+
+void BatchSimulation::updateModes()
+{
+  for (int i = 0; i < numGames_; i++) {
+    if (!isActive_[i]) continue;
+    if (direction_[SLOT_PACMAN][i] == DIRECTION_NONE) {
+      // Game hasn't started. Ghosts start off in Scatter mode.
+      currentMode_[i] = false;
+      currentModeIndex_[i] = 0;
+    } else if (!isModeTimerRunning_[i]) {
+      isModeTimerRunning_[i] = true;
+      modeTicks_[i] = 0;
+    } else {
+      modeTicks_[i]++;
+      int seconds = Simulation::MODE_SCHEDULE[currentModeIndex_[i]];
+      if (seconds == -1) {
+        currentMode_[i] = true;
+      } else if (modeTicks_[i] / ticksPerSecond_ > seconds) {
+        currentModeIndex_[i]++;
+        currentMode_[i] = !currentMode_[i];
+        modeTicks_[i] = 0;
+      }
+    }
+  }
+}
+
+template <typename Targeting>
+void BatchSimulation::findTargets(ActorSlot slot)
+{
+  // Only Chase, Scatter and Eaten ghosts follow their target, but
+  // every ghost's is worked out, so the loop has no branches.
+  uint8_t *state = state_[slot];
+  TargetInputs in;
+  in.scatterTileX = scatterX_[slot];
+  in.scatterTileY = scatterY_[slot];
+  in.homeTileX = gateTileX_;
+  in.homeTileY = gateTileY_;
+  in.spotTileX = spotX_[slot] / TILE_SUBPIXELS;
+  in.spotTileY = spotY_[slot] / TILE_SUBPIXELS;
+  for (int i = 0; i < numGames_; i++) {
+    in.state = state[i];
+    in.tileX = (x_[slot][i] + HALF_TILE_SUBPIXELS) / TILE_SUBPIXELS;
+    in.tileY = (y_[slot][i] + HALF_TILE_SUBPIXELS) / TILE_SUBPIXELS;
+    in.pacmanTileX = (x_[SLOT_PACMAN][i] + HALF_TILE_SUBPIXELS) / TILE_SUBPIXELS;
+    in.pacmanTileY = (y_[SLOT_PACMAN][i] + HALF_TILE_SUBPIXELS) / TILE_SUBPIXELS;
+    getAhead(direction_[SLOT_PACMAN][i], &in.pacmanAheadX, &in.pacmanAheadY);
+    in.partnerTileX = (x_[SLOT_BLINKY][i] + HALF_TILE_SUBPIXELS) / TILE_SUBPIXELS;
+    in.partnerTileY = (y_[SLOT_BLINKY][i] + HALF_TILE_SUBPIXELS) / TILE_SUBPIXELS;
+    Targeting::find(in, &targetX_[i], &targetY_[i]);
+  }
+}
+
+void BatchSimulation::moveGhosts(ActorSlot slot)
+{
+  // Game starts when PACMAN starts moving. Ghosts wait until then.
+  for (int i = 0; i < numGames_; i++) {
+    if (isActive_[i] && direction_[SLOT_PACMAN][i] != DIRECTION_NONE) {
+      moveGhost(i, slot);
+    }
+  }
+}
+
+void BatchSimulation::moveGhost(int game, ActorSlot slot)
+{
+  int x = x_[slot][game];
+  int y = y_[slot][game];
+  int tileX = (x + HALF_TILE_SUBPIXELS) / TILE_SUBPIXELS;
+  int tileY = (y + HALF_TILE_SUBPIXELS) / TILE_SUBPIXELS;
+  bool isAtTileCenter = (x == tileX * TILE_SUBPIXELS && y == tileY * TILE_SUBPIXELS);
+  uint8_t *state = &state_[slot][game];
+  uint8_t *direction = &direction_[slot][game];
+  startGhostTick(game, slot);
+
+  // At the start of game, waiting until can start to leave home.
+  int *waitingPellets = &waitingPellets_[slot][game];
+  if (*waitingPellets == 0) {
+    *state = GHOST_FINDING_EXIT;
+    *waitingPellets = -1;
+  } else if (*waitingPellets > 0) {
+    // Bounce against the walls of the base.
+    if (!moveGhostForwardWithCollision(game, slot)) {
+      *direction = (uint8_t)getOppositeDirection((Direction)*direction);
+      moveGhostForwardWithCollision(game, slot);
+    }
+    return;
+  }
+
+  if (*state == GHOST_FINDING_EXIT) {
+    if (x == gateX_ && y == gateY_) {
+      // Finished walking out of the base.
+      *state = getChaseOrScatter(game);
+    } else if (x != gateX_) {
+      // Line up with the gates, then walk up through them.
+      *direction = (x < gateX_) ? DIRECTION_RIGHT : DIRECTION_LEFT;
+      moveGhostForwardWithCollision(game, slot);
+    } else {
+      *direction = DIRECTION_UP;
+      moveGhostForwardWithCollision(game, slot);
+    }
+  } else if (*state == GHOST_FINDING_SPOT) {
+    if (x == spotX_[slot] && y == spotY_[slot]) {
+      // Back in their spot in base. Leave again from next tick.
+      *state = GHOST_FINDING_EXIT;
+    } else if (y != spotY_[SLOT_PINKY]) {
+      // Down to Pinky's height, then across to their spot.
+      *direction = DIRECTION_DOWN;
+      moveGhostForwardWithCollision(game, slot);
+    } else {
+      *direction = (spotX_[slot] < spotX_[SLOT_PINKY]) ? DIRECTION_LEFT : DIRECTION_RIGHT;
+      moveGhostForwardWithCollision(game, slot);
+    }
+  } else if (*state == GHOST_FRIGHTENED) {
+    if (isAtTileCenter) {
+      // Randomly pick a way on, other than straight back.
+      int exits = tileExits_.getExits(tileX, tileY) &
+                  ~getDirectionBit(getOppositeDirection((Direction)*direction));
+      int numExits = 0;
+      for (int d = DIRECTION_UP; d <= DIRECTION_RIGHT; d++) {
+        if (exits & getDirectionBit((Direction)d)) numExits++;
+      }
+      if (numExits > 0) {
+        int pick = (numExits == 1) ? 0 : random_[game].nextInt(numExits);
+        for (int d = DIRECTION_UP; d <= DIRECTION_RIGHT; d++) {
+          if ((exits & getDirectionBit((Direction)d)) && pick-- == 0) {
+            *direction = (uint8_t)d;
+            break;
+          }
+        }
+        moveGhostForwardWithCollision(game, slot);
+      }
+    } else {
+      moveGhostForwardWithCollision(game, slot);
+    }
+  } else {
+    // Scatter, Chase or Eaten. Turn around on switching mode.
+    if (*state == GHOST_SCATTER || *state == GHOST_CHASE) {
+      uint8_t newState = getChaseOrScatter(game);
+      if (newState != *state) {
+        *direction = (uint8_t)getOppositeDirection((Direction)*direction);
+      }
+      *state = newState;
+    }
+
+    Direction ranked[4];
+    if (isAtTileCenter) {
+      // Take the way on closest to the target, other than straight back.
+      int exits = tileExits_.getExits(tileX, tileY) &
+                  ~getDirectionBit(getOppositeDirection((Direction)*direction));
+      if (exits != 0 && (exits & (exits - 1)) == 0) {
+        // In a corridor, or round a corner: follow it.
+        *direction = (uint8_t)getOnlyDirection(exits);
+        moveGhostForwardWithCollision(game, slot);
+      } else if (rankDirections(tileX, tileY, exits, targetX_[game], targetY_[game], ranked) > 0) {
+        *direction = (uint8_t)ranked[0];
+        moveGhostForwardWithCollision(game, slot);
+      }
+    } else if (x == gateX_ && y == gateY_) {
+      // Half way between two tiles, outside the gates: try each way.
+      int exits = getDirectionBit(DIRECTION_UP) | getDirectionBit(DIRECTION_DOWN) |
+                  getDirectionBit(DIRECTION_LEFT) | getDirectionBit(DIRECTION_RIGHT);
+      exits &= ~getDirectionBit(getOppositeDirection((Direction)*direction));
+      int numRanked = rankDirections(tileX, tileY, exits, targetX_[game], targetY_[game], ranked);
+      for (int i = 0; i < numRanked; i++) {
+        *direction = (uint8_t)ranked[i];
+        if (moveGhostForwardWithCollision(game, slot)) {
+          break;
+        }
+      }
+    } else {
+      moveGhostForwardWithCollision(game, slot);
+    }
+  }
+}
+
+void BatchSimulation::startGhostTick(int game, ActorSlot slot)
+{
+  // As Actor::startTick(), at the speed for the ghost's state, or
+  // slowed down in the tunnels to the portals, unless eaten.
+  int state = state_[slot][game];
+  int tileX = (x_[slot][game] + HALF_TILE_SUBPIXELS) / TILE_SUBPIXELS;
+  int tileY = (y_[slot][game] + HALF_TILE_SUBPIXELS) / TILE_SUBPIXELS;
+  bool isInTunnel = tunnelOneEndX_ != -1 && tileY == portalOneY_ &&
+                    (tileX <= tunnelOneEndX_ || tileX >= tunnelTwoEndX_);
+  int speed = (isInTunnel && state != GHOST_EATEN) ? ghostTunnelSpeed_ : ghostSpeeds_[state];
+  int carried = (lastMove_[slot][game] > 0) ? movement_[slot][game] : 0;
+  if (carried > speed) carried = speed;
+  movement_[slot][game] = carried + speed;
+  lastMove_[slot][game] = 0;
+}
+
+bool BatchSimulation::moveGhostForwardWithCollision(int game, ActorSlot slot)
+{
+  int direction = direction_[slot][game];
+  int dx = (direction == DIRECTION_RIGHT) - (direction == DIRECTION_LEFT);
+  int dy = (direction == DIRECTION_DOWN) - (direction == DIRECTION_UP);
+  int distance = getDistanceToStop((dy != 0) ? y_[slot][game] : x_[slot][game],
+                                   (Direction)direction, TILE_SIZE);
+  int move = (movement_[slot][game] < distance) ? movement_[slot][game] : distance;
+  int x = x_[slot][game] + (move * dx);
+  int y = y_[slot][game] + (move * dy);
+  if (isGhostBlocked(game, slot, x, y)) {
+    lastMove_[slot][game] = 0;
+    return false;
+  }
+  x_[slot][game] = x;
+  y_[slot][game] = y;
+  movement_[slot][game] -= move;
+  lastMove_[slot][game] = move;
+
+  // Check if this ghost crashed into PACMAN.
+  uint8_t *state = &state_[slot][game];
+  int tileX = (x + HALF_TILE_SUBPIXELS) / TILE_SUBPIXELS;
+  int tileY = (y + HALF_TILE_SUBPIXELS) / TILE_SUBPIXELS;
+  if (tileX == (x_[SLOT_PACMAN][game] + HALF_TILE_SUBPIXELS) / TILE_SUBPIXELS &&
+      tileY == (y_[SLOT_PACMAN][game] + HALF_TILE_SUBPIXELS) / TILE_SUBPIXELS &&
+      *state != GHOST_EATEN) {
+    if (*state == GHOST_FRIGHTENED && power_[game] > 0) {
+      *state = GHOST_EATEN;
+    } else {
+      gameOver(game, false);
+    }
+  }
+
+  // Eaten ghosts arriving at the gates go in to find their spot.
+  if (*state == GHOST_EATEN && x == gateX_ && y == gateY_) {
+    *state = GHOST_FINDING_SPOT;
+  }
+
+  // Exactly in a portal, come out of the other one.
+  if (tiles_[getTileIndex(game, tileX, tileY)] == TILE_PORTAL &&
+      x == tileX * TILE_SUBPIXELS && y == tileY * TILE_SUBPIXELS) {
+    if (tileX == portalOneX_ && tileY == portalOneY_) {
+      x_[slot][game] = portalTwoX_ * TILE_SUBPIXELS;
+      y_[slot][game] = portalTwoY_ * TILE_SUBPIXELS;
+    } else {
+      x_[slot][game] = portalOneX_ * TILE_SUBPIXELS;
+      y_[slot][game] = portalOneY_ * TILE_SUBPIXELS;
+    }
+  }
+  return true;
+}
+
+void BatchSimulation::drainPower()
+{
+  for (int i = 0; i < numGames_; i++) {
+    int power = power_[i];
+    int isDraining = isActive_[i] && power > 0;
+    power -= isDraining;
+    // Flash frightened ghosts 3 times in the last 1.5 seconds.
+    uint8_t isFlashing = isFrightenedFlashing_[i];
+    isFlashing = (power == flashTicks_[0]) ? 1 : (power == flashTicks_[1]) ? 0 :
+                 (power == flashTicks_[2]) ? 1 : (power == flashTicks_[3]) ? 0 :
+                 (power == flashTicks_[4]) ? 1 : (power == flashTicks_[5]) ? 0 : isFlashing;
+    isFrightenedFlashing_[i] = isDraining ? isFlashing : isFrightenedFlashing_[i];
+    // Out of power, so un-frighten all ghosts before next tick starts.
+    int hasRunOut = isActive_[i] && power == 0;
+    hasPowerRunOut_[i] = (uint8_t)hasRunOut;
+    power_[i] = hasRunOut ? -1 : power;
+  }
+  for (int slot = SLOT_BLINKY; slot <= SLOT_CLYDE; slot++) {
+    uint8_t *state = state_[slot];
+    for (int i = 0; i < numGames_; i++) {
+      uint8_t chaseOrScatter = currentMode_[i] ? GHOST_CHASE : GHOST_SCATTER;
+      state[i] = (hasPowerRunOut_[i] && state[i] == GHOST_FRIGHTENED) ? chaseOrScatter : state[i];
+    }
+  }
+}
+
+void BatchSimulation::gameOver(int game, bool isWin)
+{
+  isGameOver_[game] = true;
+  isGameOverWin_[game] = isWin;
+}
+
+// Tile holding the top left corner of an actor at position, which
+// can be as much as half a tile off the board.
+static inline int getCornerTile(int position)
+{
+  return ((position + TILE_SUBPIXELS) / TILE_SUBPIXELS) - 1;
+}
+
+bool BatchSimulation::isPacmanBlocked(int game, int x, int y)
+{
+  // Actors are exactly one tile in size, so overlap
+  // the tile their top left corner is in, and maybe
+  // the tiles to the right and below. Part way into
+  // a portal, the corner is off the board to the left,
+  // so round down rather than towards zero.
+  const uint8_t *tile = &tiles_[getTileIndex(game, getCornerTile(x), getCornerTile(y))];
+  int right = (x % TILE_SUBPIXELS != 0);
+  int below = (y % TILE_SUBPIXELS != 0) ? stride_ : 0;
+  int overlapped = (1 << tile[0]) | (1 << tile[right]) |
+                   (1 << tile[below]) | (1 << tile[below + right]);
+  return (overlapped & PACMAN_BLOCKERS) != 0;
+}
+
+bool BatchSimulation::isGhostBlocked(int game, ActorSlot slot, int x, int y)
+{
+  // Ghosts can pass through the gates only when entering or leaving the base.
+  int state = state_[slot][game];
+  int blockers = (state == GHOST_FINDING_SPOT || state == GHOST_FINDING_EXIT) ?
+                 GHOST_BLOCKERS : GHOST_OUTSIDE_BLOCKERS;
+  const uint8_t *tile = &tiles_[getTileIndex(game, getCornerTile(x), getCornerTile(y))];
+  int right = (x % TILE_SUBPIXELS != 0);
+  int below = (y % TILE_SUBPIXELS != 0) ? stride_ : 0;
+  int overlapped = (1 << tile[0]) | (1 << tile[right]) |
+                   (1 << tile[below]) | (1 << tile[below + right]);
+  return (overlapped & blockers) != 0;
+}
+
+GHOST_STATE BatchSimulation::getChaseOrScatter(int game)
+{
+  return currentMode_[game] ? GHOST_CHASE : GHOST_SCATTER;
+}
+
+int BatchSimulation::getBoardWidth()
+{
+  return boardWidth_;
+}
+
+int BatchSimulation::getBoardHeight()
+{
+  return boardHeight_;
+}
+
+int BatchSimulation::getX(int game, ActorSlot slot)
+{
+  return x_[slot][game] / Actor::SUBPIXELS;
+}
+
+int BatchSimulation::getY(int game, ActorSlot slot)
+{
+  return y_[slot][game] / Actor::SUBPIXELS;
+}
+
+int BatchSimulation::getSubpixelX(int game, ActorSlot slot)
+{
+  return x_[slot][game];
+}
+
+int BatchSimulation::getSubpixelY(int game, ActorSlot slot)
+{
+  return y_[slot][game];
+}
+
+Direction BatchSimulation::getDirection(int game, ActorSlot slot)
+{
+  return (Direction)direction_[slot][game];
+}
+
+GHOST_STATE BatchSimulation::getState(int game, ActorSlot slot)
+{
+  return (GHOST_STATE)state_[slot][game];
+}
+
+int BatchSimulation::getPower(int game)
+{
+  return power_[game];
+}
+
+int BatchSimulation::getPellets(int game)
+{
+  return pellets_[game];
+}
+
+int BatchSimulation::getTotalPellets()
+{
+  return totalPellets_;
+}
+
+bool BatchSimulation::isGameOver(int game)
+{
+  return isGameOver_[game];
+}
+
+bool BatchSimulation::isGameOverWin(int game)
+{
+  return isGameOverWin_[game];
+}
+
+bool BatchSimulation::isFrightenedFlashing(int game)
+{
+  return isFrightenedFlashing_[game];
+}
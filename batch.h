@@ -0,0 +1,185 @@
+#ifndef batch_h
+#define batch_h
+
+#include <stdint.h>
+#include "actor.h"
+#include "direction.h"
+#include "random.h"
+#include "simulation.h"
+#include "tile.h"
+#include "tileexits.h"
+
+// The actors of a game, in the order they move on each tick.
+typedef enum {
+  SLOT_PACMAN,
+  SLOT_BLINKY,
+  SLOT_INKY,
+  SLOT_PINKY,
+  SLOT_CLYDE,
+  NUM_SLOTS
+} ActorSlot;
+
+/**
+ * Many independent games of one level, stepped together one tick
+ * at a time, for bots and AI evaluation where no one is watching.
+ *
+ * The rules are exactly those of Simulation: game i, reset with a seed and
+ * stepped with the same directions, plays out exactly like a Simulation
+ * created with that seed. What differs is the layout. Each piece of state
+ * is one array over all games (positions, directions and states per actor
+ * slot, one tile grid per game), and a tick is a short series of passes,
+ * each a flat loop over every game. The passes doing arithmetic (trial
+ * moves, targets, timers) are branch free so the compiler can vectorize
+ * them; the passes reading tile grids or making ghost decisions are tight
+ * scalar loops over the same arrays.
+ *
+ * Animations are not simulated.
+ */
+class BatchSimulation {
+  public:
+    /**
+     * Allocate numGames games of the given level, or the default level if
+     * NULL, stepped ticksPerSecond times per second, and reset game i with
+     * seed i + 1. As for Simulation, the level is only read here.
+     */
+    BatchSimulation(int numGames, int ticksPerSecond = Simulation::DEFAULT_TICKS_PER_SECOND,
+                    Level *level = NULL);
+    ~BatchSimulation();
+
+    // Return whether initialisation succeeded.
+    bool getSuccess();
+
+    int getNumGames();
+    int getTicksPerSecond();
+
+    // Start the given game again from the beginning, with the given seed.
+    void reset(int game, uint32_t seed);
+
+    /**
+     * Step every game by one tick, game i in directions[i], with the same
+     * meaning as Simulation::update(). Games that are over don't change.
+     */
+    void step(const Direction *directions);
+
+    // Board of the given game. As for Simulation, tiles one
+    // beyond any edge of the board can be read, and are walls.
+    int getBoardWidth();
+    int getBoardHeight();
+    TileType getTile(int game, int tileX, int tileY)
+    {
+      return (TileType)tiles_[(game * gridSize_) + ((tileY + 1) * stride_) + tileX + 1];
+    }
+
+    // Actors of the given game, as from the matching Actor getters.
+    int getX(int game, ActorSlot slot);
+    int getY(int game, ActorSlot slot);
+    int getSubpixelX(int game, ActorSlot slot);
+    int getSubpixelY(int game, ActorSlot slot);
+    Direction getDirection(int game, ActorSlot slot);
+    GHOST_STATE getState(int game, ActorSlot slot);
+    int getPower(int game);
+
+    int getPellets(int game);
+    int getTotalPellets();
+    bool isGameOver(int game);
+    bool isGameOverWin(int game);
+    bool isFrightenedFlashing(int game);
+
+  private:
+    // Passes making up one tick, in order.
+    void movePacman(const Direction *directions);
+    void setPacmanTrials();
+    void eatPellets();
+    void collidePacmanWithGhosts();
+    void updateModes();
+    template <typename Targeting>
+    void findTargets(ActorSlot slot);
+    void moveGhosts(ActorSlot slot);
+    void drainPower();
+
+    // Per game helpers for the scalar passes.
+    void gameOver(int game, bool isWin);
+    bool isPacmanBlocked(int game, int x, int y);
+    bool isGhostBlocked(int game, ActorSlot slot, int x, int y);
+    void moveGhost(int game, ActorSlot slot);
+    bool moveGhostForwardWithCollision(int game, ActorSlot slot);
+    void startGhostTick(int game, ActorSlot slot);
+    GHOST_STATE getChaseOrScatter(int game);
+    int getTileIndex(int game, int tileX, int tileY)
+    {
+      return (game * gridSize_) + ((tileY + 1) * stride_) + tileX + 1;
+    }
+
+    bool success_;
+    int numGames_;
+    int ticksPerSecond_;
+
+    /* Shared by every game. */
+
+    int boardWidth_;
+    int boardHeight_;
+    int stride_;            // Bytes from one row of a tile grid to the next.
+    int gridSize_;          // Bytes in one tile grid, including its border.
+    uint8_t *startTiles_;   // The tile grid every game starts with.
+    int totalPellets_;
+    TileExits tileExits_;
+    int portalOneX_;
+    int portalOneY_;
+    int portalTwoX_;
+    int portalTwoY_;
+    int tunnelOneEndX_;     // Last tiles of the tunnels to the portals,
+    int tunnelTwoEndX_;     // as for Simulation.
+    int startX_[NUM_SLOTS]; // Positions are all in sub-pixels.
+    int startY_[NUM_SLOTS];
+    Direction startDirection_[NUM_SLOTS];
+    int startWaitingPellets_[NUM_SLOTS];
+    int spotX_[NUM_SLOTS];  // Where each ghost goes in the base.
+    int spotY_[NUM_SLOTS];
+    int scatterX_[NUM_SLOTS]; // Each ghost's corner, in tile space.
+    int scatterY_[NUM_SLOTS];
+    int gateX_;             // Just outside the gates of the base,
+    int gateY_;             // where Blinky starts.
+    int gateTileX_;         // Blinky's start tile.
+    int gateTileY_;
+    int powerTicks_;        // How long a power pellet lasts.
+    int flashTicks_[6];     // When frightened ghosts flash on and off.
+    int pacmanSpeed_;       // Speeds in sub-pixels per tick.
+    int pacmanPowerSpeed_;
+    int ghostTunnelSpeed_;
+    int ghostSpeeds_[NUM_GHOST_STATES];
+
+    /* One entry per game. */
+
+    uint8_t *tiles_;        // numGames_ tile grids, one after another.
+    int *x_[NUM_SLOTS];
+    int *y_[NUM_SLOTS];
+    uint8_t *direction_[NUM_SLOTS];
+    uint8_t *state_[NUM_SLOTS];
+    int *waitingPellets_[NUM_SLOTS];
+    int *movement_[NUM_SLOTS]; // As for Actor.
+    int *lastMove_[NUM_SLOTS];
+    int *power_;
+    int *pellets_;
+    uint8_t *isGameOver_;
+    uint8_t *isGameOverWin_;
+    uint8_t *isFrightenedFlashing_;
+    uint8_t *currentMode_;  // 0 is Scatter mode, 1 is Chase mode.
+    int *currentModeIndex_;
+    uint8_t *isModeTimerRunning_;
+    int *modeTicks_;
+    Random *random_;
+
+    // Scratch space for the passes of a tick.
+    uint8_t *isActive_;     // Game wasn't over when this tick started.
+    uint8_t *hasPacmanMoved_;
+    uint8_t *hasPowerRunOut_;
+    uint8_t *trialDirection_;
+    int *trialX_;
+    int *trialY_;
+    int *trialMove_;
+    uint8_t *isBlocked_;
+    int *targetX_;
+    int *targetY_;
+};
+
+#endif /* batch_h */
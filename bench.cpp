@@ -0,0 +1,796 @@
+// Micro and macrobenchmarks for the simulation, runnable without a window.
+// See renderbench.cpp for drawing.
+//
+// Build and run with:
+//   cmake --build build --target bench
+//   ./build/bench
+//
+// Also time replaying recorded games (see --record), and print one line
+// of JSON per result, tagged with a name for this build, for comparing
+// against another build:
+//   ./build/bench --json --label before --replay game.rec > before.jsonl
+//
+// Or check that stepping the simulation never allocates, exiting with
+// failure if it does:
+//   ./build/bench --check-allocations
+//
+// Or check that BatchSimulation plays exactly the same games as
+// Simulation, exiting with failure if any game differs:
+//   ./build/bench --check-batch
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include "allocations.h"
+#include "batch.h"
+#include "benchmark.h"
+#include "board.h"
+#include "level.h"
+#include "occupancy.h"
+#include "recording.h"
+#include "simulation.h"
+
+// Stops the compiler from optimising away work whose result is unused.
+static volatile int sink;
+
+/* Tile grid layouts: the board as it used to be stored, and as it is now. */
+
+// One malloc'd column of int-sized tiles per x, bounds checked on every read.
+struct ColumnBoard {
+  TileType **columns;
+  int width;
+  int height;
+};
+
+struct Layouts {
+  ColumnBoard column;
+  Board *padded;
+  // Pixel positions (top left corner) of actors to run collision scans for.
+  int numPositions;
+  int *positionsX;
+  int *positionsY;
+};
+
+static void setupLayouts(Layouts *layouts, Simulation *simulation)
+{
+  int width = simulation->getBoardWidth();
+  int height = simulation->getBoardHeight();
+
+  layouts->column.width = width;
+  layouts->column.height = height;
+  layouts->column.columns = (TileType **)malloc(width * sizeof(TileType *));
+  for (int x = 0; x < width; x++) {
+    layouts->column.columns[x] = (TileType *)malloc(height * sizeof(TileType));
+  }
+  layouts->padded = new Board();
+  layouts->padded->init(width, height);
+  for (int y = 0; y < height; y++) {
+    for (int x = 0; x < width; x++) {
+      layouts->column.columns[x][y] = simulation->getTile(x, y);
+      layouts->padded->setTile(x, y, simulation->getTile(x, y));
+    }
+  }
+
+  // Every pixel position in every open tile, stepping like an actor does.
+  int tileSize = Simulation::TILE_SIZE;
+  layouts->numPositions = 0;
+  layouts->positionsX = (int *)malloc(width * height * (tileSize / 3) * sizeof(int));
+  layouts->positionsY = (int *)malloc(width * height * (tileSize / 3) * sizeof(int));
+  for (int y = 0; y < height; y++) {
+    for (int x = 0; x < width; x++) {
+      if (simulation->getTile(x, y) == TILE_WALL) continue;
+      for (int offset = 0; offset < tileSize; offset += 3) {
+        layouts->positionsX[layouts->numPositions] = (x * tileSize) + offset;
+        layouts->positionsY[layouts->numPositions] = y * tileSize;
+        layouts->numPositions++;
+      }
+    }
+  }
+}
+
+static void freeLayouts(Layouts *layouts)
+{
+  for (int x = 0; x < layouts->column.width; x++) {
+    free(layouts->column.columns[x]);
+  }
+  free(layouts->column.columns);
+  delete layouts->padded;
+  free(layouts->positionsX);
+  free(layouts->positionsY);
+}
+
+// Same overlap test the simulation uses.
+static bool isOverlapping(int actorX, int actorY, int tileX, int tileY)
+{
+  int tileSize = Simulation::TILE_SIZE;
+  if (actorY + tileSize <= tileY * tileSize) return false;
+  if ((tileY + 1) * tileSize <= actorY) return false;
+  if (actorX + tileSize <= tileX * tileSize) return false;
+  if ((tileX + 1) * tileSize <= actorX) return false;
+  return true;
+}
+
+// 3x3 wall scan around every actor position, as in moveGhostForwardWithCollision.
+static void benchCollisionColumn(void *arg)
+{
+  Layouts *layouts = (Layouts *)arg;
+  ColumnBoard *board = &layouts->column;
+  int walls = 0;
+  for (int p = 0; p < layouts->numPositions; p++) {
+    int actorX = layouts->positionsX[p];
+    int actorY = layouts->positionsY[p];
+    int centerX = (actorX + 12) / Simulation::TILE_SIZE;
+    int centerY = (actorY + 12) / Simulation::TILE_SIZE;
+    for (int i = -1; i <= 1; i++) {
+      for (int j = -1; j <= 1; j++) {
+        if (centerX + i < 0 || centerX + i > board->width - 1 ||
+            centerY + j < 0 || centerY + j > board->height - 1) {
+          continue;
+        }
+        if (board->columns[centerX + i][centerY + j] == TILE_WALL &&
+            isOverlapping(actorX, actorY, centerX + i, centerY + j)) {
+          walls++;
+        }
+      }
+    }
+  }
+  sink = walls;
+}
+
+static void benchCollisionPadded(void *arg)
+{
+  Layouts *layouts = (Layouts *)arg;
+  Board *board = layouts->padded;
+  int walls = 0;
+  for (int p = 0; p < layouts->numPositions; p++) {
+    int actorX = layouts->positionsX[p];
+    int actorY = layouts->positionsY[p];
+    int centerX = (actorX + 12) / Simulation::TILE_SIZE;
+    int centerY = (actorY + 12) / Simulation::TILE_SIZE;
+    for (int i = -1; i <= 1; i++) {
+      for (int j = -1; j <= 1; j++) {
+        if (board->getTile(centerX + i, centerY + j) == TILE_WALL &&
+            isOverlapping(actorX, actorY, centerX + i, centerY + j)) {
+          walls++;
+        }
+      }
+    }
+  }
+  sink = walls;
+}
+
+// Row by row scan of every tile for pellets, as in Game::render.
+static void benchRenderScanColumn(void *arg)
+{
+  ColumnBoard *board = &((Layouts *)arg)->column;
+  int pellets = 0;
+  for (int j = 0; j < board->height; j++) {
+    for (int i = 0; i < board->width; i++) {
+      TileType tile = board->columns[i][j];
+      if (tile == TILE_PELLET || tile == TILE_POWER_PELLET) pellets++;
+    }
+  }
+  sink = pellets;
+}
+
+static void benchRenderScanPadded(void *arg)
+{
+  Board *board = ((Layouts *)arg)->padded;
+  int width = board->getWidth();
+  int height = board->getHeight();
+  int pellets = 0;
+  for (int j = 0; j < height; j++) {
+    const uint8_t *row = board->getRow(j);
+    for (int i = 0; i < width; i++) {
+      if (row[i] == TILE_PELLET || row[i] == TILE_POWER_PELLET) pellets++;
+    }
+  }
+  sink = pellets;
+}
+
+/* Crowds of ghosts: finding which actors share a tile. */
+
+static const int NUM_CROWD_SIZES = 5;
+static const int CROWD_SIZES[NUM_CROWD_SIZES] = { 4, 16, 64, 256, 1000 };
+
+struct Crowd {
+  Layouts *layouts;
+  int numActors;
+  int step;           // Moves every actor on a little on every call.
+  int *tilesX;        // Per actor, tile it is in on this call.
+  int *tilesY;
+  OccupancyGrid grid;
+};
+
+// Move every actor of crowd on to its next position, spread over the board.
+static void moveCrowd(Crowd *crowd)
+{
+  Layouts *layouts = crowd->layouts;
+  crowd->step++;
+  for (int i = 0; i < crowd->numActors; i++) {
+    int p = ((i * 7919) + (crowd->step * 3)) % layouts->numPositions;
+    crowd->tilesX[i] = (layouts->positionsX[p] + 12) / Simulation::TILE_SIZE;
+    crowd->tilesY[i] = (layouts->positionsY[p] + 12) / Simulation::TILE_SIZE;
+  }
+}
+
+// Find every pair of actors in the same tile by checking every pair.
+static void benchCrowdAllPairs(void *arg)
+{
+  Crowd *crowd = (Crowd *)arg;
+  moveCrowd(crowd);
+  int collisions = 0;
+  for (int i = 0; i < crowd->numActors; i++) {
+    for (int j = i + 1; j < crowd->numActors; j++) {
+      if (crowd->tilesX[i] == crowd->tilesX[j] && crowd->tilesY[i] == crowd->tilesY[j]) {
+        collisions++;
+      }
+    }
+  }
+  sink = collisions;
+}
+
+// The same, keeping the grid up to date and only checking actors sharing a tile.
+static void benchCrowdGrid(void *arg)
+{
+  Crowd *crowd = (Crowd *)arg;
+  moveCrowd(crowd);
+  for (int i = 0; i < crowd->numActors; i++) {
+    crowd->grid.move(i, crowd->tilesX[i], crowd->tilesY[i]);
+  }
+  int collisions = 0;
+  for (int i = 0; i < crowd->numActors; i++) {
+    for (int j = crowd->grid.getFirst(crowd->tilesX[i], crowd->tilesY[i]);
+         j != -1; j = crowd->grid.getNext(j)) {
+      if (j > i && crowd->tilesX[i] == crowd->tilesX[j] && crowd->tilesY[i] == crowd->tilesY[j]) {
+        collisions++;
+      }
+    }
+  }
+  sink = collisions;
+}
+
+/* Steps of a tick on their own, through SimulationBench. */
+
+/**
+ * For calling the parts of Simulation that make up a tick one at a time.
+ * A friend of Simulation, so keep to calling through, no logic.
+ */
+class SimulationBench {
+  public:
+    static int getPacmanSpeed(Simulation *simulation)
+    {
+      return simulation->pacmanSpeed_;
+    }
+    
+    static bool movePacmanForwardWithCollision(Simulation *simulation)
+    {
+      return simulation->movePacmanForwardWithCollision();
+    }
+    
+    static void moveGhost(Simulation *simulation, Actor *ghost, int targetTileX, int targetTileY)
+    {
+      simulation->moveGhost(ghost, targetTileX, targetTileY);
+    }
+    
+    static bool isCollidingWithTile(Simulation *simulation, Actor *actor, int tileX, int tileY)
+    {
+      return simulation->isCollidingWithTile(actor, tileX, tileY);
+    }
+};
+
+static const char *GHOST_STATE_NAMES[NUM_GHOST_STATES] = {
+  "waiting", "chase", "scatter", "eaten", "frightened", "finding-spot", "finding-exit"
+};
+
+static const int MAX_SAMPLES = 4096;
+
+/**
+ * Actors as they were at the end of ticks of real games, to start each
+ * call of a step from. Ghosts are kept apart by state, so each state
+ * can be timed on its own.
+ */
+struct Samples {
+  Simulation *simulation;   // Steps are timed on this one's actors.
+  Actor *pacmen;
+  int numPacmen;
+  Actor *ghosts[NUM_GHOST_STATES];
+  int numGhosts[NUM_GHOST_STATES];
+  int next;                 // Sample the next call starts from.
+  GHOST_STATE state;        // Ghost state being timed.
+};
+
+/**
+ * Play scripted games, keeping actors from every few ticks, until there
+ * are MAX_SAMPLES of PACMAN and of each ghost state, or games run out.
+ */
+static void takeSamples(Samples *samples)
+{
+  samples->simulation = new Simulation();
+  samples->pacmen = (Actor *)malloc(MAX_SAMPLES * sizeof(Actor));
+  samples->numPacmen = 0;
+  for (int i = 0; i < NUM_GHOST_STATES; i++) {
+    samples->ghosts[i] = (Actor *)malloc(MAX_SAMPLES * sizeof(Actor));
+    samples->numGhosts[i] = 0;
+  }
+  samples->next = 0;
+
+  for (int script = 1; script <= 256; script++) {
+    Simulation *simulation = new Simulation(Simulation::DEFAULT_TICKS_PER_SECOND, script);
+    for (int tick = 0; tick < 10000 && !simulation->isGameOver(); tick++) {
+      simulation->update(getScriptedDirection(script, tick));
+      if (tick % 3 != 0) continue;
+      if (samples->numPacmen < MAX_SAMPLES) {
+        samples->pacmen[samples->numPacmen++] = *simulation->getPacman();
+      }
+      for (int i = 0; i < simulation->getNumGhosts(); i++) {
+        Actor *ghost = simulation->getGhost(i);
+        GHOST_STATE state = ghost->getState();
+        if (samples->numGhosts[state] < MAX_SAMPLES) {
+          samples->ghosts[state][samples->numGhosts[state]++] = *ghost;
+        }
+      }
+    }
+    delete simulation;
+  }
+}
+
+static void freeSamples(Samples *samples)
+{
+  delete samples->simulation;
+  free(samples->pacmen);
+  for (int i = 0; i < NUM_GHOST_STATES; i++) free(samples->ghosts[i]);
+}
+
+// PACMAN's move on one tick, from where PACMAN was in some game.
+static void benchMovePacman(void *arg)
+{
+  Samples *samples = (Samples *)arg;
+  Actor *pacman = samples->simulation->getPacman();
+  *pacman = samples->pacmen[samples->next];
+  samples->next = (samples->next + 1) % samples->numPacmen;
+  pacman->startTick(SimulationBench::getPacmanSpeed(samples->simulation));
+  sink = SimulationBench::movePacmanForwardWithCollision(samples->simulation);
+}
+
+// One ghost's move on one tick, from where a ghost in samples->state was
+// in some game, heading for the target it had then.
+static void benchMoveGhost(void *arg)
+{
+  Samples *samples = (Samples *)arg;
+  Actor *ghost = samples->simulation->getGhost(0);
+  *ghost = samples->ghosts[samples->state][samples->next];
+  samples->next = (samples->next + 1) % samples->numGhosts[samples->state];
+  SimulationBench::moveGhost(samples->simulation, ghost,
+                             ghost->getTargetTileX(), ghost->getTargetTileY());
+  sink = ghost->getSubpixelX();
+}
+
+// The 3x3 tiles around PACMAN, as movePacmanForwardWithCollision checks.
+static void benchIsCollidingWithTile(void *arg)
+{
+  Samples *samples = (Samples *)arg;
+  Actor *pacman = &samples->pacmen[samples->next];
+  samples->next = (samples->next + 1) % samples->numPacmen;
+  int tileX = pacman->getTileX();
+  int tileY = pacman->getTileY();
+  int collisions = 0;
+  for (int i = -1; i <= 1; i++) {
+    for (int j = -1; j <= 1; j++) {
+      collisions += SimulationBench::isCollidingWithTile(samples->simulation, pacman,
+                                                         tileX + i, tileY + j);
+    }
+  }
+  sink = collisions;
+}
+
+/* Saving and putting back the whole state of a game, as netplay rolls back. */
+
+struct SavedGame {
+  Simulation *simulation;   // Part way through a game.
+  SimulationState *state;   // Saved from it.
+};
+
+static void benchSaveState(void *arg)
+{
+  SavedGame *saved = (SavedGame *)arg;
+  sink = saved->simulation->saveState(saved->state);
+}
+
+static void benchRestoreState(void *arg)
+{
+  SavedGame *saved = (SavedGame *)arg;
+  saved->simulation->restoreState(saved->state);
+  sink = saved->simulation->getPellets();
+}
+
+/* Whole games: the simulation as Game steps it, minus the window. */
+
+/**
+ * Step simulation until PACMAN wins or dies, steering with the given script.
+ * \Returns how many ticks were played.
+ */
+static int playScriptedGame(Simulation *simulation, int script)
+{
+  int tick = 0;
+  for (; tick < 10000 && !simulation->isGameOver(); tick++) {
+    simulation->update(getScriptedDirection(script, tick));
+  }
+  return tick;
+}
+
+// Ticks played by the last call of benchGame.
+static int gameTicks;
+
+// Play one game from the start. Same seed, so every call plays the same game.
+static void benchGame(void *)
+{
+  Simulation *simulation = new Simulation(Simulation::DEFAULT_TICKS_PER_SECOND, 1);
+  gameTicks = playScriptedGame(simulation, 1);
+  delete simulation;
+}
+
+// Ticks in the recording being replayed by benchReplay.
+static int replayTicks;
+
+// Replay a recorded game from the start, including setting up the simulation.
+static void benchReplay(void *arg)
+{
+  Recording *recording = (Recording *)arg;
+  Simulation *simulation = new Simulation(recording->getTicksPerSecond(), recording->getSeed(),
+                                          NULL, recording->getNumGhosts());
+  recording->rewind();
+  while (!recording->isFinished()) {
+    simulation->update(recording->nextDirection());
+  }
+  replayTicks = recording->getNumTicks();
+  delete simulation;
+}
+
+/* Many games at once: a Simulation per game, or one BatchSimulation. */
+
+static const int NUM_BATCH_GAMES = 1024;
+static const int NUM_BATCH_TICKS = 600;
+
+/**
+ * Time stepping NUM_BATCH_GAMES games, game i seeded with i + 1 and
+ * steered by script i, for NUM_BATCH_TICKS ticks, not counting setup.
+ * Both ways play exactly the same games.
+ * \Returns nanoseconds per tick of one game.
+ */
+static double timeSimulations()
+{
+  typedef std::chrono::steady_clock Clock;
+  Simulation **simulations = (Simulation **)malloc(NUM_BATCH_GAMES * sizeof(Simulation *));
+  for (int i = 0; i < NUM_BATCH_GAMES; i++) {
+    simulations[i] = new Simulation(Simulation::DEFAULT_TICKS_PER_SECOND, i + 1);
+  }
+
+  Clock::time_point start = Clock::now();
+  for (int tick = 0; tick < NUM_BATCH_TICKS; tick++) {
+    for (int i = 0; i < NUM_BATCH_GAMES; i++) {
+      simulations[i]->update(getScriptedDirection(i, tick));
+    }
+  }
+  double elapsedNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+  for (int i = 0; i < NUM_BATCH_GAMES; i++) delete simulations[i];
+  free(simulations);
+  return elapsedNs / ((double)NUM_BATCH_GAMES * NUM_BATCH_TICKS);
+}
+
+static double timeBatchSimulation()
+{
+  typedef std::chrono::steady_clock Clock;
+  BatchSimulation *batch = new BatchSimulation(NUM_BATCH_GAMES);
+  Direction *directions = (Direction *)malloc(NUM_BATCH_GAMES * sizeof(Direction));
+
+  Clock::time_point start = Clock::now();
+  for (int tick = 0; tick < NUM_BATCH_TICKS; tick++) {
+    for (int i = 0; i < NUM_BATCH_GAMES; i++) {
+      directions[i] = getScriptedDirection(i, tick);
+    }
+    batch->step(directions);
+  }
+  double elapsedNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+  free(directions);
+  delete batch;
+  return elapsedNs / ((double)NUM_BATCH_GAMES * NUM_BATCH_TICKS);
+}
+
+/* One game with more and more ghosts. */
+
+static const int NUM_CROWD_TICKS = 2000;
+
+/**
+ * Time stepping a game with numGhosts ghosts for NUM_CROWD_TICKS ticks,
+ * steered by a script. With many ghosts PACMAN doesn't last long, so each
+ * time a game ends another is started, not counting setting it up.
+ * \Returns nanoseconds per tick.
+ */
+static double timeCrowdedGame(int numGhosts)
+{
+  typedef std::chrono::steady_clock Clock;
+  double elapsedNs = 0;
+  int ticks = 0;
+  for (int game = 1; ticks < NUM_CROWD_TICKS; game++) {
+    Simulation *simulation = new Simulation(Simulation::DEFAULT_TICKS_PER_SECOND, game,
+                                            NULL, numGhosts);
+    Clock::time_point start = Clock::now();
+    for (int tick = 0; ticks < NUM_CROWD_TICKS && !simulation->isGameOver(); tick++, ticks++) {
+      simulation->update(getScriptedDirection(game, tick));
+    }
+    elapsedNs += std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    delete simulation;
+  }
+  return elapsedNs / NUM_CROWD_TICKS;
+}
+
+/**
+ * Play a game with each of a number of scripts, every other one with a
+ * crowd of ghosts, counting heap allocations made while stepping the
+ * simulation, once it has been set up. Drawing is checked by renderbench.
+ * \Returns false if there were any.
+ */
+static bool checkAllocations()
+{
+  static const int NUM_SCRIPTS = 16;
+  int ticks = 0;
+  unsigned long allocations = 0;
+  for (int script = 1; script <= NUM_SCRIPTS; script++) {
+    int numGhosts = (script % 2 == 0) ? CROWD_SIZES[NUM_CROWD_SIZES - 1] :
+                                        Simulation::DEFAULT_NUM_GHOSTS;
+    Simulation *simulation = new Simulation(Simulation::DEFAULT_TICKS_PER_SECOND, script,
+                                            NULL, numGhosts);
+    if (!simulation->getSuccess()) {
+      printf("Simulation initialisation failed!\n");
+      delete simulation;
+      return false;
+    }
+    unsigned long allocationsBefore = getNumAllocations();
+    ticks += playScriptedGame(simulation, script);
+    allocations += getNumAllocations() - allocationsBefore;
+    delete simulation;
+  }
+  printf("%lu heap allocations over %d ticks of %d games.\n", allocations, ticks, NUM_SCRIPTS);
+  return allocations == 0;
+}
+
+/**
+ * Whether game of batch is exactly where simulation is: every actor's
+ * position, direction and state, PACMAN's power, the tiles left and
+ * whether the game is over and won.
+ */
+static bool isSameGame(Simulation *simulation, BatchSimulation *batch, int game)
+{
+  if (simulation->getPellets() != batch->getPellets(game) ||
+      simulation->isGameOver() != batch->isGameOver(game) ||
+      simulation->isGameOverWin() != batch->isGameOverWin(game) ||
+      simulation->isFrightenedFlashing() != batch->isFrightenedFlashing(game) ||
+      simulation->getPacman()->getPower() != batch->getPower(game)) {
+    return false;
+  }
+  for (int slot = SLOT_PACMAN; slot < NUM_SLOTS; slot++) {
+    Actor *actor = (slot == SLOT_PACMAN) ? simulation->getPacman() : simulation->getGhost(slot - SLOT_BLINKY);
+    if (actor->getSubpixelX() != batch->getSubpixelX(game, (ActorSlot)slot) ||
+        actor->getSubpixelY() != batch->getSubpixelY(game, (ActorSlot)slot) ||
+        actor->getDirection() != batch->getDirection(game, (ActorSlot)slot) ||
+        (slot != SLOT_PACMAN && actor->getState() != batch->getState(game, (ActorSlot)slot))) {
+      return false;
+    }
+  }
+  for (int y = 0; y < simulation->getBoardHeight(); y++) {
+    for (int x = 0; x < simulation->getBoardWidth(); x++) {
+      if (simulation->getTile(x, y) != batch->getTile(game, x, y)) return false;
+    }
+  }
+  return true;
+}
+
+static const int NUM_CHECK_GAMES = 64;
+static const int NUM_CHECK_TICKS = 6000;
+static const int NUM_CHECK_RATES = 4;
+static const int CHECK_RATES[NUM_CHECK_RATES] = { 7, 60, 120, 240 };
+
+/**
+ * Play NUM_CHECK_GAMES scripted games at each of a number of tick rates,
+ * both as a Simulation per game and all together as one BatchSimulation,
+ * comparing every game after every tick.
+ * \Returns false if any game played out differently either way, printing
+ * where each first did.
+ */
+static bool checkBatch()
+{
+  bool success = true;
+  int numDifferent = 0;
+  Simulation **simulations = (Simulation **)malloc(NUM_CHECK_GAMES * sizeof(Simulation *));
+  Direction *directions = (Direction *)malloc(NUM_CHECK_GAMES * sizeof(Direction));
+  bool *isDifferent = (bool *)malloc(NUM_CHECK_GAMES * sizeof(bool));
+  if (simulations == NULL || directions == NULL || isDifferent == NULL) {
+    printf("Failed to allocate memory for games!\n");
+    success = false;
+  }
+
+  for (int rate = 0; success && rate < NUM_CHECK_RATES; rate++) {
+    int ticksPerSecond = CHECK_RATES[rate];
+    // Game i of a batch is seeded with i + 1.
+    BatchSimulation *batch = new BatchSimulation(NUM_CHECK_GAMES, ticksPerSecond);
+    if (!batch->getSuccess()) success = false;
+    for (int i = 0; i < NUM_CHECK_GAMES; i++) {
+      simulations[i] = new Simulation(ticksPerSecond, i + 1);
+      if (!simulations[i]->getSuccess()) success = false;
+      isDifferent[i] = false;
+    }
+    if (!success) printf("Simulation initialisation failed!\n");
+
+    for (int tick = 0; success && tick < NUM_CHECK_TICKS; tick++) {
+      for (int i = 0; i < NUM_CHECK_GAMES; i++) {
+        directions[i] = getScriptedDirection(i, tick);
+        simulations[i]->update(directions[i]);
+      }
+      batch->step(directions);
+      for (int i = 0; i < NUM_CHECK_GAMES; i++) {
+        if (!isDifferent[i] && !isSameGame(simulations[i], batch, i)) {
+          printf("Game %d at %d ticks per second differs after tick %d!\n", i, ticksPerSecond, tick);
+          isDifferent[i] = true;
+          numDifferent++;
+        }
+      }
+    }
+
+    for (int i = 0; i < NUM_CHECK_GAMES; i++) delete simulations[i];
+    delete batch;
+  }
+
+  if (simulations != NULL) free(simulations);
+  if (directions != NULL) free(directions);
+  if (isDifferent != NULL) free(isDifferent);
+  if (success) {
+    printf("%d of %d games played out differently over %d ticks at each of %d tick rates.\n",
+           numDifferent, NUM_CHECK_GAMES, NUM_CHECK_TICKS, NUM_CHECK_RATES);
+  }
+  return success && numDifferent == 0;
+}
+
+static void printUsage(const char *program)
+{
+  printf("Usage: %s [--json] [--label build] [--replay file.rec]...\n"
+         "       %s --check-allocations\n"
+         "       %s --check-batch\n", program, program, program);
+}
+
+int main(int argc, char *argv[])
+{
+  // Read command line options.
+  const char **replayPaths = (const char **)malloc(argc * sizeof(const char *));
+  int numReplays = 0;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--check-allocations") == 0 && argc == 2) {
+      return checkAllocations() ? EXIT_SUCCESS : EXIT_FAILURE;
+    } else if (strcmp(argv[i], "--check-batch") == 0 && argc == 2) {
+      return checkBatch() ? EXIT_SUCCESS : EXIT_FAILURE;
+    } else if (strcmp(argv[i], "--json") == 0) {
+      setJsonOutput(true);
+    } else if (strcmp(argv[i], "--label") == 0 && i + 1 < argc) {
+      setBuildLabel(argv[++i]);
+    } else if (strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+      replayPaths[numReplays++] = argv[++i];
+    } else {
+      printUsage(argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+
+  Simulation *simulation = new Simulation();
+  if (!simulation->getSuccess()) {
+    printf("Simulation initialisation failed!\n");
+    return EXIT_FAILURE;
+  }
+
+  /* Microbenchmarks. */
+
+  Layouts layouts;
+  setupLayouts(&layouts, simulation);
+
+  reportHeading("Collision scans over %d actor positions, render scans over %dx%d tiles.",
+                layouts.numPositions, simulation->getBoardWidth(), simulation->getBoardHeight());
+  report("collision/column-major", timeNsPerOp(benchCollisionColumn, &layouts));
+  report("collision/padded-row-major", timeNsPerOp(benchCollisionPadded, &layouts));
+  report("render-scan/column-major", timeNsPerOp(benchRenderScanColumn, &layouts));
+  report("render-scan/padded-row-major", timeNsPerOp(benchRenderScanPadded, &layouts));
+
+  Samples samples;
+  takeSamples(&samples);
+  reportHeading("Steps of a tick, each call starting from an actor as it was in a game.");
+  report("step/movePacmanForwardWithCollision", timeNsPerOp(benchMovePacman, &samples));
+  report("step/isCollidingWithTile", timeNsPerOp(benchIsCollidingWithTile, &samples) / 9);
+  char name[64];
+  for (int state = 0; state < NUM_GHOST_STATES; state++) {
+    if (samples.numGhosts[state] == 0) continue;
+    samples.state = (GHOST_STATE)state;
+    samples.next = 0;
+    snprintf(name, sizeof(name), "step/moveGhost %s", GHOST_STATE_NAMES[state]);
+    report(name, timeNsPerOp(benchMoveGhost, &samples));
+  }
+  freeSamples(&samples);
+
+  SavedGame saved;
+  saved.simulation = new Simulation(Simulation::DEFAULT_TICKS_PER_SECOND, 1);
+  saved.state = (SimulationState *)malloc(sizeof(SimulationState));
+  for (int tick = 0; tick < 600; tick++) {
+    saved.simulation->update(getScriptedDirection(1, tick));
+  }
+  saved.simulation->saveState(saved.state);
+  int numGhostsUnused = SimulationState::MAX_GHOSTS - saved.state->numGhosts;
+  int numTileBytesUnused = SimulationState::MAX_TILE_BYTES - saved.state->numTileBytes;
+  reportHeading("The whole state of a game, %d bytes of it in use.",
+                (int)(sizeof(SimulationState) - (numGhostsUnused * sizeof(Actor)) - numTileBytesUnused));
+  report("state/save", timeNsPerOp(benchSaveState, &saved));
+  report("state/restore", timeNsPerOp(benchRestoreState, &saved));
+  free(saved.state);
+  delete saved.simulation;
+
+  reportHeading("Finding actors sharing a tile, per call, each actor moving on every call.");
+  for (int i = 0; i < NUM_CROWD_SIZES; i++) {
+    Crowd crowd;
+    crowd.layouts = &layouts;
+    crowd.numActors = CROWD_SIZES[i];
+    crowd.step = 0;
+    crowd.tilesX = (int *)malloc(crowd.numActors * sizeof(int));
+    crowd.tilesY = (int *)malloc(crowd.numActors * sizeof(int));
+    crowd.grid.init(simulation->getBoardWidth(), simulation->getBoardHeight(), crowd.numActors);
+    snprintf(name, sizeof(name), "crowd/all-pairs %d", crowd.numActors);
+    report(name, timeNsPerOp(benchCrowdAllPairs, &crowd));
+    snprintf(name, sizeof(name), "crowd/grid %d", crowd.numActors);
+    report(name, timeNsPerOp(benchCrowdGrid, &crowd));
+    free(crowd.tilesX);
+    free(crowd.tilesY);
+  }
+
+  /* Macrobenchmarks. */
+
+  double gameNs = timeNsPerOp(benchGame, NULL);
+  reportHeading("Whole games of %d ticks, including setting up the simulation.", gameTicks);
+  report("simulation/game", gameNs);
+  reportTicks("simulation/game per tick", gameNs / gameTicks);
+
+  for (int i = 0; i < numReplays; i++) {
+    Recording recording;
+    if (!recording.load(replayPaths[i])) {
+      return EXIT_FAILURE;
+    }
+    Level level;
+    if (recording.getLevelHash() != level.getHash()) {
+      printf("Recording '%s' wasn't played on the default level!\n", replayPaths[i]);
+      return EXIT_FAILURE;
+    }
+    double replayNs = timeNsPerOp(benchReplay, &recording);
+    reportHeading("Replaying '%s', %d ticks, including setting up the simulation.",
+                  replayPaths[i], replayTicks);
+    snprintf(name, sizeof(name), "replay/%s", replayPaths[i]);
+    report(name, replayNs);
+    snprintf(name, sizeof(name), "replay/%s per tick", replayPaths[i]);
+    reportTicks(name, replayNs / replayTicks);
+  }
+
+  reportHeading("%d games stepped together for %d ticks, per tick of one game.",
+                NUM_BATCH_GAMES, NUM_BATCH_TICKS);
+  reportTicks("simulation/many games", timeSimulations());
+  reportTicks("batch/many games", timeBatchSimulation());
+
+  reportHeading("One game with more ghosts, per tick, then per tick of one ghost.");
+  for (int i = 0; i < NUM_CROWD_SIZES; i++) {
+    double tickNs = timeCrowdedGame(CROWD_SIZES[i]);
+    snprintf(name, sizeof(name), "simulation/%d ghosts", CROWD_SIZES[i]);
+    reportTicks(name, tickNs);
+    snprintf(name, sizeof(name), "simulation/%d ghosts per ghost", CROWD_SIZES[i]);
+    report(name, tickNs / CROWD_SIZES[i]);
+  }
+
+  freeLayouts(&layouts);
+  free(replayPaths);
+  delete simulation;
+  return EXIT_SUCCESS;
+}
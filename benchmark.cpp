@@ -0,0 +1,82 @@
+#include <stdarg.h>
+#include <stdio.h>
+#include <chrono>
+#include "benchmark.h"
+
+static bool isJsonOutput = false;
+static const char *buildLabel = NULL;
+
+double timeNsPerOp(void (*benchmark)(void *), void *arg)
+{
+  typedef std::chrono::steady_clock Clock;
+
+  // Warm up caches and branch predictors first.
+  for (int i = 0; i < 100; i++) benchmark(arg);
+
+  long ops = 0;
+  double elapsedNs = 0;
+  for (long batch = 1000; elapsedNs < 1e8; batch *= 2) {
+    Clock::time_point start = Clock::now();
+    for (long i = 0; i < batch; i++) benchmark(arg);
+    elapsedNs += std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    ops += batch;
+  }
+  return elapsedNs / ops;
+}
+
+void setJsonOutput(bool isJson)
+{
+  isJsonOutput = isJson;
+}
+
+void setBuildLabel(const char *label)
+{
+  buildLabel = label;
+}
+
+void reportHeading(const char *format, ...)
+{
+  if (isJsonOutput) return;
+  va_list args;
+  va_start(args, format);
+  vprintf(format, args);
+  va_end(args);
+  printf("\n");
+}
+
+// Start a line of JSON, up to and including the result's name.
+static void startJson(const char *name)
+{
+  printf("{");
+  if (buildLabel != NULL) printf("\"build\":\"%s\",", buildLabel);
+  printf("\"name\":\"%s\"", name);
+}
+
+void report(const char *name, double nsPerOp)
+{
+  if (isJsonOutput) {
+    startJson(name);
+    printf(",\"ns_per_op\":%.1f}\n", nsPerOp);
+  } else {
+    printf("%-36s %12.1f ns/op\n", name, nsPerOp);
+  }
+}
+
+void reportTicks(const char *name, double nsPerTick)
+{
+  double ticksPerSecond = (nsPerTick > 0) ? 1e9 / nsPerTick : 0;
+  if (isJsonOutput) {
+    startJson(name);
+    printf(",\"ns_per_tick\":%.1f,\"ticks_per_second\":%.0f}\n", nsPerTick, ticksPerSecond);
+  } else {
+    printf("%-36s %12.1f ns/tick %12.0f ticks/s\n", name, nsPerTick, ticksPerSecond);
+  }
+}
+
+Direction getScriptedDirection(int script, int tick)
+{
+  static const Direction directions[4] = {
+    DIRECTION_UP, DIRECTION_DOWN, DIRECTION_LEFT, DIRECTION_RIGHT
+  };
+  return directions[((tick / 37) * 7 + script) % 4];
+}
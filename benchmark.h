@@ -0,0 +1,43 @@
+#ifndef benchmark_h
+#define benchmark_h
+
+#include "direction.h"
+
+/**
+ * Timing and reporting shared by bench and renderbench.
+ *
+ * Results are printed as a table by default. With setJsonOutput(true),
+ * each result is instead one line of JSON, e.g.
+ *
+ *   {"build":"before","name":"simulation/game per tick","ns_per_tick":935.7,"ticks_per_second":1068719}
+ *
+ * and headings are left out, so the output of two builds can be compared
+ * line by line with any JSON tool.
+ */
+
+/**
+ * Time how long one call of benchmark takes, in nanoseconds, averaged
+ * over enough calls to take at least a tenth of a second.
+ */
+double timeNsPerOp(void (*benchmark)(void *), void *arg);
+
+// Print results as lines of JSON rather than a table.
+void setJsonOutput(bool isJson);
+
+// Tag every JSON result with this build's name, if not NULL.
+void setBuildLabel(const char *label);
+
+// A line of text describing the results after it. Not printed as JSON.
+void reportHeading(const char *format, ...);
+
+// One result, in nanoseconds per op.
+void report(const char *name, double nsPerOp);
+
+// One result, in nanoseconds per tick, also given as ticks per second.
+void reportTicks(const char *name, double nsPerTick);
+
+// Direction a fixed wandering script steers PACMAN in on the given tick;
+// different scripts wander differently.
+Direction getScriptedDirection(int script, int tick);
+
+#endif /* benchmark_h */
@@ -0,0 +1,65 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "board.h"
+
+Board::Board()
+{
+  tiles_ = NULL;
+  origin_ = NULL;
+  width_ = 0;
+  height_ = 0;
+  stride_ = 0;
+}
+
+Board::~Board()
+{
+  if (tiles_ != NULL) free(tiles_);
+}
+
+bool Board::init(int width, int height)
+{
+  if (tiles_ != NULL) free(tiles_);
+  
+  width_ = width;
+  height_ = height;
+  stride_ = width + 2;
+  tiles_ = (uint8_t *)malloc(stride_ * (height + 2));
+  if (tiles_ == NULL) {
+    printf("Failed to allocate memory for board of tiles!\n");
+    return false;
+  }
+  origin_ = tiles_ + stride_ + 1;
+  
+  // Walls all the way round, nothing inside.
+  memset(tiles_, TILE_WALL, stride_ * (height + 2));
+  for (int y = 0; y < height; y++) {
+    memset(origin_ + (y * stride_), TILE_NONE, width);
+  }
+  return true;
+}
+
+int Board::getWidth()
+{
+  return width_;
+}
+
+int Board::getHeight()
+{
+  return height_;
+}
+
+int Board::getNumBytes()
+{
+  return stride_ * (height_ + 2);
+}
+
+void Board::save(uint8_t *bytes)
+{
+  memcpy(bytes, tiles_, stride_ * (height_ + 2));
+}
+
+void Board::restore(const uint8_t *bytes)
+{
+  memcpy(tiles_, bytes, stride_ * (height_ + 2));
+}
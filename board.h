@@ -0,0 +1,62 @@
+#ifndef board_h
+#define board_h
+
+#include <stdint.h>
+#include "tile.h"
+
+/**
+ * The grid of tiles making up a level, stored as one contiguous,
+ * row-major array of bytes.
+ *
+ * The grid is surrounded by a one tile thick border of walls, so the
+ * eight neighbours of any tile on the board can be read without checking
+ * if they are off the board: getTile() accepts tileX from -1 to width,
+ * and tileY from -1 to height.
+ */
+class Board {
+  public:
+    Board();
+    ~Board();
+    
+    /**
+     * Allocate an empty width x height board, surrounded by walls.
+     * \Returns false if unable to allocate the board.
+     */
+    bool init(int width, int height);
+    
+    int getWidth();
+    int getHeight();
+    
+    // Defined here so they can be inlined into the per-tick collision scans.
+    TileType getTile(int tileX, int tileY)
+    {
+      return (TileType)origin_[(tileY * stride_) + tileX];
+    }
+    void setTile(int tileX, int tileY, TileType tile)
+    {
+      origin_[(tileY * stride_) + tileX] = (uint8_t)tile;
+    }
+    
+    // The width tiles of row tileY, for scanning a row at a time.
+    const uint8_t *getRow(int tileY)
+    {
+      return origin_ + (tileY * stride_);
+    }
+    
+    // Bytes taken by every tile, including the border.
+    int getNumBytes();
+    
+    // Copy every tile out into bytes, or back in from bytes, which
+    // hold getNumBytes() bytes, for saving and restoring the board.
+    void save(uint8_t *bytes);
+    void restore(const uint8_t *bytes);
+    
+  private:
+    uint8_t *tiles_;  // Including the border.
+    uint8_t *origin_; // Tile (0, 0), just inside the border.
+    int width_;
+    int height_;
+    int stride_;      // Bytes from one row to the next.
+};
+
+#endif /* board_h */
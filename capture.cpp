@@ -0,0 +1,196 @@
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include "capture.h"
+
+// How long the writer sleeps when it has caught up with the game.
+static const std::chrono::milliseconds IDLE_SLEEP(2);
+
+FrameCapture::FrameCapture()
+{
+  numGhosts_ = 0;
+  numTiles_ = 0;
+  overflow_ = CAPTURE_WAIT;
+  numFramesDropped_ = 0;
+  file_ = NULL;
+  isPipe_ = false;
+  planes_ = NULL;
+  numFramesWritten_ = 0;
+  isWriteFailed_ = false;
+  isStopping_ = false;
+  for (int i = 0; i < NUM_SLOTS; i++) {
+    frames_.getBuffer(i)->ghosts = NULL;
+    frames_.getBuffer(i)->tiles = NULL;
+  }
+}
+
+FrameCapture::~FrameCapture()
+{
+  if (isStarted()) stop();
+  for (int i = 0; i < NUM_SLOTS; i++) {
+    if (frames_.getBuffer(i)->ghosts != NULL) free(frames_.getBuffer(i)->ghosts);
+    if (frames_.getBuffer(i)->tiles != NULL) free(frames_.getBuffer(i)->tiles);
+  }
+  if (planes_ != NULL) free(planes_);
+}
+
+bool FrameCapture::start(const char *path, Level *level, int numGhosts, int frameRate,
+                         CaptureOverflow overflow)
+{
+  numGhosts_ = numGhosts;
+  numTiles_ = level->getWidth() * level->getHeight();
+  overflow_ = overflow;
+  if (!rasterizer_.init(level, numGhosts)) {
+    return false;
+  }
+
+  // Every buffer is allocated now, so capturing never allocates.
+  int width = rasterizer_.getWidth();
+  int height = rasterizer_.getHeight();
+  planes_ = (uint8_t *)malloc((width * height) + (2 * (width / 2) * (height / 2)));
+  bool success = (planes_ != NULL);
+  for (int i = 0; success && i < NUM_SLOTS; i++) {
+    Snapshot *frame = frames_.getBuffer(i);
+    frame->ghosts = (ActorSnapshot *)malloc(numGhosts * sizeof(ActorSnapshot));
+    frame->tiles = (uint8_t *)malloc(numTiles_);
+    if (frame->ghosts == NULL || frame->tiles == NULL) success = false;
+  }
+  if (!success) {
+    printf("Failed to allocate memory for capturing frames!\n");
+    return false;
+  }
+
+  if (path[0] == '|') {
+    // A command that exits early should fail writes, not kill the game.
+    signal(SIGPIPE, SIG_IGN);
+    file_ = popen(path + 1, "w");
+    isPipe_ = true;
+  } else {
+    file_ = fopen(path, "wb");
+  }
+  if (file_ == NULL) {
+    printf("Unable to open '%s' for capturing!\n", path);
+    return false;
+  }
+
+  // Full range BT.601, chroma centred between each 2x2 block of pixels.
+  fprintf(file_, "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C420jpeg\n", width, height, frameRate);
+  isStopping_ = false;
+  writerThread_ = std::thread(&FrameCapture::writerLoop, this);
+  return true;
+}
+
+void FrameCapture::addFrame(const Snapshot *snapshot)
+{
+  Snapshot *frame = frames_.getBack();
+  if (frame == NULL && overflow_ == CAPTURE_DROP) {
+    numFramesDropped_++;
+    return;
+  }
+  while (frame == NULL) {
+    // Back-pressure: the game waits for the writer.
+    std::this_thread::yield();
+    frame = frames_.getBack();
+  }
+
+  // Copy the whole snapshot, as the slot's is from many frames ago.
+  ActorSnapshot *ghosts = frame->ghosts;
+  uint8_t *tiles = frame->tiles;
+  *frame = *snapshot;
+  frame->ghosts = ghosts;
+  frame->tiles = tiles;
+  memcpy(ghosts, snapshot->ghosts, numGhosts_ * sizeof(ActorSnapshot));
+  memcpy(tiles, snapshot->tiles, numTiles_);
+  frames_.push();
+}
+
+bool FrameCapture::stop()
+{
+  isStopping_ = true;
+  writerThread_.join();
+
+  bool success = !isWriteFailed_;
+  if (isPipe_) {
+    if (pclose(file_) != 0) success = false;
+  } else if (fclose(file_) != 0) {
+    success = false;
+  }
+  file_ = NULL;
+  if (!success) printf("Failed to write captured frames!\n");
+  return success;
+}
+
+bool FrameCapture::isStarted()
+{
+  return file_ != NULL;
+}
+
+int FrameCapture::getNumFramesWritten()
+{
+  return numFramesWritten_;
+}
+
+int FrameCapture::getNumFramesDropped()
+{
+  return numFramesDropped_;
+}
+
+void FrameCapture::writerLoop()
+{
+  while (true) {
+    // Checked before looking for a frame, so none queued before
+    // stopping are left behind.
+    bool isStopping = isStopping_;
+    const Snapshot *frame = frames_.getFront();
+    if (frame == NULL) {
+      if (isStopping) return;
+      std::this_thread::sleep_for(IDLE_SLEEP);
+      continue;
+    }
+
+    rasterizer_.render(frame);
+    frames_.pop();
+    if (!isWriteFailed_ && !writeFrame()) {
+      // Keep taking frames, so the game isn't held up by a dead encoder.
+      isWriteFailed_ = true;
+    }
+    numFramesWritten_++;
+  }
+}
+
+bool FrameCapture::writeFrame()
+{
+  int width = rasterizer_.getWidth();
+  int height = rasterizer_.getHeight();
+  int chromaWidth = width / 2;
+  const uint32_t *pixels = rasterizer_.getPixels();
+  uint8_t *lumas = planes_;
+  uint8_t *blues = lumas + (width * height);
+  uint8_t *reds = blues + (chromaWidth * (height / 2));
+
+  // A 2x2 block of pixels at a time: a luma for each, and the average of
+  // the four for the chroma.
+  for (int y = 0; y + 1 < height; y += 2) {
+    for (int x = 0; x + 1 < width; x += 2) {
+      int sumR = 0, sumG = 0, sumB = 0;
+      for (int i = 0; i < 4; i++) {
+        int offset = ((y + (i / 2)) * width) + x + (i % 2);
+        uint32_t pixel = pixels[offset];
+        int r = (pixel >> 24) & 0xFF;
+        int g = (pixel >> 16) & 0xFF;
+        int b = (pixel >> 8) & 0xFF;
+        lumas[offset] = (uint8_t)(((77 * r) + (150 * g) + (29 * b) + 128) >> 8);
+        sumR += r;
+        sumG += g;
+        sumB += b;
+      }
+      int chroma = ((y / 2) * chromaWidth) + (x / 2);
+      blues[chroma] = (uint8_t)((((-43 * sumR) - (84 * sumG) + (127 * sumB) + 512) >> 10) + 128);
+      reds[chroma] = (uint8_t)((((127 * sumR) - (106 * sumG) - (21 * sumB) + 512) >> 10) + 128);
+    }
+  }
+
+  size_t size = (width * height) + (2 * chromaWidth * (height / 2));
+  return fputs("FRAME\n", file_) >= 0 && fwrite(planes_, 1, size, file_) == size;
+}
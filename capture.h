@@ -0,0 +1,93 @@
+#ifndef capture_h
+#define capture_h
+
+#include <stdint.h>
+#include <stdio.h>
+#include <atomic>
+#include <thread>
+
+#include "level.h"
+#include "rasterizer.h"
+#include "snapshot.h"
+#include "spscqueue.h"
+
+// What to do with a frame when the writer is too far behind to take it.
+typedef enum {
+  CAPTURE_WAIT,  // Hold up the game until the writer catches up.
+  CAPTURE_DROP   // Leave the frame out of the video.
+} CaptureOverflow;
+
+/**
+ * Writes every frame shown to a Y4M video, on a thread of its own, so
+ * the game loop never waits on a disk or an encoder.
+ *
+ * A frame is captured as the snapshot it was drawn from, copied into one
+ * of a fixed ring of slots allocated up front, which is a few kilobytes
+ * rather than megabytes of pixels read back from the renderer. The writer
+ * thread takes each from the ring in turn, draws it with Rasterizer,
+ * converts it to 4:2:0 YUV, and writes it out.
+ *
+ * The video can go to a file, or into a command, such as an encoder,
+ * when the path starts with '|':
+ *
+ *   |ffmpeg -i - -c:v libx264 gameplay.mp4
+ */
+class FrameCapture {
+  public:
+    FrameCapture();
+    ~FrameCapture();
+
+    /**
+     * Start writing frames of games of the given level, against the given
+     * number of ghosts, shown frameRate times per second, to path.
+     * \Returns false if unable to open path or allocate the frames.
+     */
+    bool start(const char *path, Level *level, int numGhosts, int frameRate,
+               CaptureOverflow overflow);
+
+    /**
+     * Queue the frame drawn from snapshot to be written. Never waits
+     * unless the ring is full and the overflow setting is CAPTURE_WAIT.
+     */
+    void addFrame(const Snapshot *snapshot);
+
+    /**
+     * Write every frame still queued, stop the writer thread, and close
+     * the video. \Returns false if anything failed to be written.
+     */
+    bool stop();
+
+    bool isStarted();
+    int getNumFramesWritten();
+    int getNumFramesDropped();
+
+  private:
+    // On the writer thread: write frames as they come, until stopped.
+    void writerLoop();
+
+    // Convert the rasterizer's frame to YUV and write it out.
+    bool writeFrame();
+
+    // Slots in the ring. Enough to cover the writer being held up for
+    // about a quarter of a second at 60 frames per second.
+    static const int NUM_SLOTS = 16;
+
+    SpscQueue<Snapshot, NUM_SLOTS> frames_;
+    int numGhosts_;
+    int numTiles_;
+    CaptureOverflow overflow_;
+    int numFramesDropped_;              // Game loop's.
+
+    // Writer thread's, once started.
+    FILE *file_;
+    bool isPipe_;                       // file_ is from popen().
+    Rasterizer rasterizer_;
+    uint8_t *planes_;                   // Y, then U, then V.
+    int numFramesWritten_;
+    bool isWriteFailed_;
+
+    std::thread writerThread_;
+    std::atomic<bool> isStopping_;
+};
+
+#endif /* capture_h */
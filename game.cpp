@@ -1,52 +1,82 @@
 #include <stdio.h>
 #include <cassert>
-#include <cmath>
 #include "game.h"
-#include <vector>
-#include <utility>
 #include <cstdlib>
 #include <ctime>
-#include "level.h"
 #include "actor.h"
+#include "scene.h"
+#include "wall.h"
 
-Game::Game()
+// Input is handed to the simulation thread as one value: the Direction in
+// the low bits, and when its key went down (see getKeyDownTime()) above.
+static const int INPUT_DIRECTION_BITS = 3;
+static const Uint64 INPUT_DIRECTION_MASK = (1 << INPUT_DIRECTION_BITS) - 1;
+
+static Uint64 packInput(Direction direction, Uint64 keyDownTime)
+{
+  return (keyDownTime << INPUT_DIRECTION_BITS) | direction;
+}
+
+const char *Game::PHASE_NAMES[NUM_PHASES] = { "POLL", "SNAPSHOT", "RENDER", "PRESENT", "CAPTURE", "SLEEP" };
+
+Game::Game(const GameOptions &options)
 {
+  options_ = options;
+  input_ = DIRECTION_NONE;
+  nextTickTime_ = 0;
+  isTurnBufferCleared_ = false;
+  turnBuffer_ = DIRECTION_NONE;
+  inputTime_ = 0;
+  presentedInputTime_ = 0;
   window_ = NULL;
   renderer_ = NULL;
   spritesheet_ = NULL;
-  board_ = NULL;
-  pacman_ = NULL;
-  blinky_ = NULL;
-  inky_ = NULL;
-  pinky_ = NULL;
-  clyde_ = NULL;
-  pellets_ = 0;
-  totalPellets_ = 0;
-  isGameOver_ = false;
-  isGameOverWin_ = false;
-  portalOneX = -1;
-  portalOneY = -1;
-  portalTwoX = -1;
-  portalTwoY = -1;
-  modes_ = NULL;
-  currentModeIndex_ = 0;
-  currentMode_ = false;
-  frightenedGhostSprite_ = { .x = 0, .y = 0, .w = 48, .h = 48 };
-  numFramesPassed = 0;
-  averageFrameTime = 0;
+  mazeTexture_ = NULL;
+  wallSprites_ = NULL;
+  frameTexture_ = NULL;
+  drawnTiles_ = NULL;
+  drawnSpriteRects_ = NULL;
+  numDirtyRects_ = 0;
+  numDrawnSpriteRects_ = 0;
+  drawnPelletAnimationFrame_ = -1;
+  isFrameTextureStale_ = true;
+  simulation_ = NULL;
+  boardWidth_ = 0;
+  boardHeight_ = 0;
+  numGhosts_ = 0;
+  snapshot_ = NULL;
+  isStopping_ = false;
+  for (int i = 0; i < TripleBuffer<Snapshot>::NUM_BUFFERS; i++) {
+    snapshots_.getBuffer(i)->ghosts = NULL;
+    snapshots_.getBuffer(i)->tiles = NULL;
+  }
+  numStalls_ = 0;
+  numFrameAllocations_ = 0;
+  isOverlayVisible_ = false;
 
   success_ = false;
   
   bool success = true;
   
-  /* Initialising SDL. */
+  if (options_.simulationRate <= 0 || options_.displayRate <= 0) {
+    printf("Simulation and display rates must be positive!\n");
+    success = false;
+  }
   
-  if (SDL_InitSubSystem(SDL_INIT_VIDEO) != 0) {
-    printf("SDL video initialisation failed! SDL Error %s\n", SDL_GetError());
+  // The level decides the size of the window, so comes first.
+  Level *level = new Level();
+  if (success && options_.levelPath != NULL && !level->load(options_.levelPath)) {
     success = false;
   }
-  if (success && IMG_Init(IMG_INIT_PNG) != IMG_INIT_PNG) {
-    printf("SDL_image initialisation failed! SDL Error %s\n", SDL_GetError());
+  if (success && !level->getSuccess()) {
+    printf("Level initialisation failed!\n");
+    success = false;
+  }
+  
+  /* Initialising SDL. */
+  
+  if (success && SDL_InitSubSystem(SDL_INIT_VIDEO) != 0) {
+    printf("SDL video initialisation failed! SDL Error %s\n", SDL_GetError());
     success = false;
   }
   if (success && TTF_Init() == -1) {
@@ -56,162 +86,103 @@ Game::Game()
   
   // Initialise pacman-sdl2 application window and its screen renderer.
   if (success) {
-    window_ = SDL_CreateWindow("Pacman SDL2", SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED, TILE_SIZE * 28, TILE_SIZE * 36, 0);
+    window_ = SDL_CreateWindow("Pacman SDL2", SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED, TILE_SIZE * level->getWidth(), TILE_SIZE * level->getHeight(), 0);
     if (window_ == NULL) {
       printf("pacman-sdl2 application window initialisation failed! SDL Error %s\n", SDL_GetError());
       success = false;
     }
   }
   if (success) {
-    renderer_ = SDL_CreateRenderer(window_, -1, SDL_RENDERER_ACCELERATED);
+    Uint32 rendererFlags = (options_.useSoftwareRenderer) ? SDL_RENDERER_SOFTWARE : SDL_RENDERER_ACCELERATED;
+    renderer_ = SDL_CreateRenderer(window_, -1, rendererFlags);
     if (renderer_ == NULL) {
       printf("pacman-sdl2 application window renderer could not be created! SDL Error %s\n", SDL_GetError());
       success = false;
     }
   }
   
-  // Get spritesheet image.
-  SDL_Surface *tempSurface = NULL;
-  if (success) {
-    tempSurface = IMG_Load("/spritesheet.png");
-    if (tempSurface == NULL) {
-      printf("Failed to load image!\n");
-      success = false;
-    }
-  }
-  
-  // And convert to texture.
+  // The sprite atlas is built into the game (see atlasgen), so just
+  // needs copying into a texture.
   if (success) {
-    spritesheet_ = SDL_CreateTextureFromSurface(renderer_, tempSurface);
+    spritesheet_ = SDL_CreateTexture(renderer_, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_STATIC,
+                                     ATLAS_WIDTH, ATLAS_HEIGHT);
     if (spritesheet_ == NULL) {
-      printf("Failed to convert image to texture! SDL Error: %s\n",
+      printf("Failed to create sprite atlas texture! SDL Error: %s\n",
              SDL_GetError());
       success = false;
     }
   }
+  if (success && (SDL_UpdateTexture(spritesheet_, NULL, ATLAS_PIXELS, ATLAS_WIDTH * sizeof(uint32_t)) != 0 ||
+                  SDL_SetTextureBlendMode(spritesheet_, SDL_BLENDMODE_BLEND) != 0)) {
+    printf("Failed to fill sprite atlas texture! SDL Error: %s\n",
+           SDL_GetError());
+    success = false;
+  }
   
-  // Free temp resource.
-  SDL_FreeSurface(tempSurface);
+  // Sprites from the atlas are drawn in batches.
+  if (success && !spriteBatch_.init(spritesheet_)) {
+    success = false;
+  }
   
   /* Initialising game state. */
   
-  // rand() is only used for frightened ghosts.
-  if (success) srand((unsigned int)time(NULL));
+  // A different game every time, unless asked for a particular seed.
+  uint32_t seed = options_.seed;
+  if (seed == 0) seed = options_.isNetplay ? 1 : (uint32_t)time(NULL);
   
-  // Used by ghosts to find out how long to wait in current mode before switching.
+  // Build the simulation of the level.
   if (success) {
-    modes_ = (int *)malloc(8 * sizeof(int));
-    if (modes_ == NULL) {
-      printf("Failed to allocate memory for list of mode switching times!\n");
+    simulation_ = new Simulation(options_.simulationRate, seed, level, options_.numGhosts);
+    if (simulation_->getSuccess() == false) {
+      printf("Simulation initialisation failed!\n");
       success = false;
     }
+    boardWidth_ = simulation_->getBoardWidth();
+    boardHeight_ = simulation_->getBoardHeight();
+    numGhosts_ = simulation_->getNumGhosts();
   }
-  if (success) {
-    modes_[0] = 7; modes_[1] = 20; // Wave 1. 7 seconds scatter, 20 seconds chase.
-    modes_[2] = 7; modes_[3] = 20; // Wave 2. 7 seconds scatter, 20 seconds chase.
-    modes_[4] = 5; modes_[5] = 20; // Wave 3. 5 seconds scatter, 20 seconds chase.
-    modes_[6] = 5; modes_[7] = -1; // Endless Wave. 7 seconds scatter, endless chase.
+  if (success && options_.isNetplay && !netplay_.start(simulation_, options_.netplay)) {
+    printf("Failed to start netplay!\n");
+    success = false;
   }
   
-  // Initialise timer used to track when to mode switch.
-  if (success) timer_ = new Timer();
-  
-  // Get default level and allocate space for game board.
-  Level *level = new Level();
-  if (success) {
-    boardHeight_ = level->getHeight();
-    boardWidth_ = level->getWidth();
-    board_ = (TileType **)malloc(boardWidth_ * sizeof(TileType *));
-    if (board_ == NULL) {
-      printf("Failed to allocate memory for board of tiles!\n");
+  // Each snapshot keeps its own copy of the board and the ghosts.
+  for (int i = 0; success && i < TripleBuffer<Snapshot>::NUM_BUFFERS; i++) {
+    Snapshot *snapshot = snapshots_.getBuffer(i);
+    snapshot->ghosts = (ActorSnapshot *)malloc(numGhosts_ * sizeof(ActorSnapshot));
+    snapshot->tiles = (uint8_t *)malloc(boardWidth_ * boardHeight_);
+    snapshot->boardVersion = -1;
+    if (snapshot->ghosts == NULL || snapshot->tiles == NULL) {
+      printf("Failed to allocate memory for snapshots!\n");
       success = false;
     }
   }
-  if (success) {
-    for (int x = 0; x < boardWidth_; x++) {
-      board_[x] = (TileType *)malloc(boardHeight_ * sizeof(TileType));
-      if (board_[x] == NULL) {
-        printf("Failed to allocate memory for row of tiles!\n");
-        success = false;
-      }
-    }
+  if (success && options_.recordPath != NULL) {
+    recording_.start(seed, options_.simulationRate, numGhosts_, level->getHash());
   }
   
-  // Build game board.
-  if (success) for (int y = 0; y < boardHeight_; y++) {
-    std::string levelText = level->getLevelText();
-    for (int x = 0; x < boardWidth_; x++) {
-      char c = levelText.at(y * boardWidth_ + x);
-      switch (c) {
-        case '-':
-          board_[x][y] = TILE_NONE;
-          break;
-        case '#':
-          board_[x][y] = TILE_WALL;
-          break;
-        case 'x':
-          board_[x][y] = TILE_PELLET;
-          totalPellets_ += 1;
-          break;
-        case 'y':
-          board_[x][y] = TILE_POWER_PELLET;
-          break;
-        case '+': // Base.
-          board_[x][y] = TILE_BASE;
-          break;
-        case 'g': // Gate of base.
-          board_[x][y] = TILE_GATE;
-          break;
-        case 't': // Teleport, Tunnel.
-          board_[x][y] = TILE_PORTAL;
-          if (portalOneX == -1) {
-            portalOneX = x;
-            portalOneY = y;
-          } else {
-            portalTwoX = x;
-            portalTwoY = y;
-          }
-          break;
-        case '0': // PACMAN. At start stands below the base.
-          board_[x][y] = TILE_NONE;
-          if (pacman_ == NULL) {
-            pacman_ = new Actor(x, y, TILE_SIZE, DIRECTION_NONE);
-          }
-          break;
-        case 'b': // Blinky. At start stands on a tile outside base,
-                  // The tile that all ghosts target to reach home.
-          board_[x][y] = TILE_NONE;
-          if (blinky_ == NULL) {
-            blinky_ = new Actor(x, y, TILE_SIZE, DIRECTION_LEFT, 0, x, y + 3);
-          }
-          break;
-        case 'i': // Inky. At start stands inside base.
-          board_[x][y] = TILE_BASE;
-          if (inky_ == NULL) {
-            inky_ = new Actor(x, y, TILE_SIZE, DIRECTION_UP, 30, x, y);
-          }
-          break;
-        case 'p': // Pinky. At start stands inside base.
-          board_[x][y] = TILE_BASE;
-          if (pinky_ == NULL) {
-            pinky_ = new Actor(x, y, TILE_SIZE, DIRECTION_DOWN, 10, x, y);
-          }
-          break;
-        case 'c': // Clyde. At start stands inside base.
-          board_[x][y] = TILE_BASE;
-          if (clyde_ == NULL) {
-            clyde_ = new Actor(x, y, TILE_SIZE, DIRECTION_UP, 90, x, y);
-          }
-          break;
-        default:
-          printf("Unexpected character! '%c'\n", c);
-          break;
-      }
-    }
+  // Walls never change, so were worked out when the level was compiled.
+  if (success && !resolveWallSprites(level)) {
+    success = false;
+  }
+  
+  // Frames are captured as they are shown, so at the display rate.
+  if (success && options_.capturePath != NULL &&
+      !capture_.start(options_.capturePath, level, numGhosts_, options_.displayRate,
+                      options_.captureOverflow)) {
+    success = false;
   }
   
   // Free temp resource.
   delete level;
+  if (success && !buildMazeTexture()) {
+    // Not fatal, will just draw the maze tile by tile every frame instead.
+    printf("Failed to cache maze, drawing it every frame instead. SDL Error: %s\n", SDL_GetError());
+  }
+  if (success && options_.useDirtyRects && !setupDirtyRects()) {
+    // Not fatal either, will just redraw the whole screen every frame.
+    printf("Failed to set up dirty rects, redrawing every frame instead. SDL Error: %s\n", SDL_GetError());
+  }
   
   // Set to let caller know that initialisation succeeded.
   success_ = success;
@@ -221,21 +192,27 @@ Game::Game()
 
 Game::~Game()
 {
+  // For running simulation.
+  if (simulationThread_.joinable()) {
+    isStopping_ = true;
+    simulationThread_.join();
+  }
+  if (simulation_ != NULL) delete simulation_;
+  for (int i = 0; i < TripleBuffer<Snapshot>::NUM_BUFFERS; i++) {
+    if (snapshots_.getBuffer(i)->ghosts != NULL) free(snapshots_.getBuffer(i)->ghosts);
+    if (snapshots_.getBuffer(i)->tiles != NULL) free(snapshots_.getBuffer(i)->tiles);
+  }
+  
   // For drawing.
   if (window_ != NULL) SDL_DestroyWindow(window_);
   if (renderer_ != NULL) SDL_DestroyRenderer(renderer_);
   if (spritesheet_ != NULL) SDL_DestroyTexture(spritesheet_);
+  if (mazeTexture_ != NULL) SDL_DestroyTexture(mazeTexture_);
+  if (wallSprites_ != NULL) free(wallSprites_);
+  if (frameTexture_ != NULL) SDL_DestroyTexture(frameTexture_);
+  if (drawnTiles_ != NULL) free(drawnTiles_);
+  if (drawnSpriteRects_ != NULL) free(drawnSpriteRects_);
   SDL_Quit();
-  
-  // For running simulation.
-  if (board_ != NULL) free(board_);
-  if (modes_ != NULL) free(modes_);
-  if (timer_ != NULL) delete timer_;
-  if (pacman_ != NULL) delete pacman_;
-  if (blinky_ != NULL) delete blinky_;
-  if (inky_ != NULL) delete inky_;
-  if (pinky_ != NULL) delete pinky_;
-  if (clyde_ != NULL) delete clyde_;
 }
 
 bool Game::getSuccess()
@@ -253,917 +230,384 @@ bool Game::run()
 
   // Keep the screen on, until user requests to quit.
   bool quit = false;
-  SDL_Event event;
   
-  Direction turnBuffer = DIRECTION_NONE;
+  // Everything is drawn from snapshots, so start with one of the
+  // simulation as it is before its first tick. Then step it on its own
+  // thread, so that drawing and presenting (which can block for a whole
+  // vsync, or longer if the compositor stalls) never hold up a tick.
+  publishSnapshot();
+  snapshots_.update();
+  snapshot_ = snapshots_.getFront();
+  isStopping_ = false;
+  simulationThread_ = std::thread(&Game::simulationLoop, this);
+  
+  // Frames are due at fixed points on the timeline, so a late frame
+  // doesn't push back every frame after it.
+  Uint64 frequency = SDL_GetPerformanceFrequency();
+  Uint64 firstFrame = SDL_GetPerformanceCounter();
+  Uint64 frameIndex = 0;
 
   // For each frame.
   while (!quit) {
-    // Marking when this frame starts, so we can find how
-    // long it took for this frame to update and render.
-    Uint32 start = SDL_GetTicks();
-    
-    // To store if user inputted a direction on this frame.
-    // If user inputted more than one direction on this frame,
-    // we will store only the most recent one.
-    Direction direction = DIRECTION_NONE;
-  
-    // Poll for user input.
-    while (SDL_PollEvent(&event) != 0) {
-      if (event.type == SDL_QUIT) {
-        // User requests to quit.
-        quit = true;
-      } else if (event.type == SDL_KEYDOWN) {
-        // User requests to change direction.
-        switch (event.key.keysym.sym) {
-          case SDLK_UP:
-            direction = DIRECTION_UP;
-            break;
-          case SDLK_DOWN:
-            direction = DIRECTION_DOWN;
-            break;
-          case SDLK_LEFT:
-            direction = DIRECTION_LEFT;
-            break;
-          case SDLK_RIGHT:
-            direction = DIRECTION_RIGHT;
-            break;
-          default:
-            break;
-        }
-      } else if (event.type == SDL_KEYUP) {
-        switch (event.key.keysym.sym) {
-          case SDLK_UP:
-          case SDLK_DOWN:
-          case SDLK_LEFT:
-          case SDLK_RIGHT:
-            // Clear turn buffer.
-            turnBuffer = DIRECTION_NONE;
-            break;
-          default:
-            break;
-        }
-      }
-    }
+    // Marking when each phase of this frame starts, so we can
+    // find how long each phase took on this frame.
+    Uint64 phaseStart = SDL_GetPerformanceCounter();
     
-    // If user didn't input a new direction this frame,
-    // take from the turn buffer.
-    if (direction == DIRECTION_NONE) {
-      direction = turnBuffer;
-    }
+    // Poll for user input, for the simulation thread to pick up.
+    pollInput(&quit);
+    phaseStart = recordPhase(PHASE_POLL, phaseStart);
     
-    // Update our simulation by one frame.
-    if (!update(direction)) {
-      // Failed to update PACMAN to new direction.
-      // Remember the direction, will use in future frames
-      // if user doesn't input a direction on those frames.
-      turnBuffer = direction;
-      pacmanAnimationFrame_ = 0;
-    }
+    // Take the newest tick the simulation has finished. It may have
+    // stepped several since last frame, or none, if it runs slower.
+    unsigned long allocationsBefore = getNumAllocations();
+    snapshots_.update();
+    snapshot_ = snapshots_.getFront();
+    phaseStart = recordPhase(PHASE_SNAPSHOT, phaseStart);
     
-    if (pacman_->getDirection() != DIRECTION_NONE) {
-      // Update PACMAN's animation frame every five frames.
-      pacmanAnimationFrameCounter_++;
-      if (pacmanAnimationFrameCounter_ % 5 == 0) {
-        pacmanAnimationFrameCounter_ = 0;
-        // Update PACMAN's animation frame.
-        pacmanAnimationFrame_ = (pacmanAnimationFrame_ == 0) ? 1 : 0;
+    // Render that tick into the back buffer, with the performance
+    // overlay on top if the player asked for it.
+    render();
+    if (isOverlayVisible_) {
+      if (frameIndex % OVERLAY_REFRESH_FRAMES == 0) {
+        overlay_.update(phaseHistograms_, PHASE_NAMES, NUM_PHASES);
       }
+      overlay_.render(renderer_);
     }
+    numFrameAllocations_ += getNumAllocations() - allocationsBefore;
+    phaseStart = recordPhase(PHASE_RENDER, phaseStart);
     
-    pelletAnimationFrameCounter_++;
-    if (pelletAnimationFrameCounter_ % 10 == 0) {
-      pelletAnimationFrameCounter_ = 0;
-      // Update pellet's animation frame.
-      pelletAnimationFrame_ = (pelletAnimationFrame_ == 0) ? 1 : 0;
+    // Present the back buffer to screen.
+    SDL_RenderPresent(renderer_);
+    phaseStart = recordPhase(PHASE_PRESENT, phaseStart);
+    if (snapshot_->inputTime != presentedInputTime_) {
+      // First frame showing what the player last did.
+      presentedInputTime_ = snapshot_->inputTime;
+      recordLatency(&inputToPresentHistogram_, presentedInputTime_);
     }
     
-    // Render the current state of our simulation to screen.
-    render();
+    // Hand what was just shown to the capture thread, to write out.
+    if (capture_.isStarted()) {
+      capture_.addFrame(snapshot_);
+    }
+    phaseStart = recordPhase(PHASE_CAPTURE, phaseStart);
     
     // Maintaining a consistent frame rate.
-    Uint32 realFrameTime = SDL_GetTicks() - start;
-    Uint32 delay = FRAME_TIME - realFrameTime;
-    if (realFrameTime > FRAME_TIME) {
-      // In case we took too long to update and render on this frame.
-      printf("we are slowwwww\n");
-      delay = 0;
+    frameIndex++;
+    Uint64 nextFrame = firstFrame + (frameIndex * frequency) / options_.displayRate;
+    Uint64 now = SDL_GetPerformanceCounter();
+    if (nextFrame < now) {
+      // Missed the frame entirely. Start counting frames again from now,
+      // instead of drawing a burst of frames to catch up.
+      firstFrame = now;
+      frameIndex = 0;
+    } else if (options_.lowLatencyInput) {
+      waitSamplingInput(nextFrame, &quit);
     } else {
-      printf("delay: %d\n", delay);
+      waitUntil(nextFrame);
     }
-    averageFrameTime = ((numFramesPassed * averageFrameTime) + realFrameTime) / (numFramesPassed + 1);
-    numFramesPassed++;
-    printf("average frame time: %lf\n", averageFrameTime);
-    SDL_Delay(delay);
+    recordPhase(PHASE_SLEEP, phaseStart);
   }
   
+  // Stop the simulation, which can then be read from this thread again.
+  isStopping_ = true;
+  simulationThread_.join();
+  
   /* Exit game loop. */
   
   // Control reaches here when user has quit the application.
+  printFrameSummary();
+  if (options_.recordPath != NULL) {
+    if (recording_.save(options_.recordPath)) {
+      printf("Recorded %d ticks (%d runs) to '%s'.\n", recording_.getNumTicks(),
+             recording_.getNumRuns(), options_.recordPath);
+    }
+  }
+  if (netplay_.isStarted()) {
+    printf("Netplay: %d ticks, %d rollbacks (%d ticks replayed, longest %d), %d stalls, "
+           "%d packets sent (%d dropped)%s.\n", netplay_.getNumTicks(),
+           netplay_.getNumRollbacks(), netplay_.getNumTicksReplayed(),
+           netplay_.getLongestRollback(), netplay_.getNumStalls(),
+           netplay_.getLink()->getNumPacketsSent(), netplay_.getLink()->getNumPacketsDropped(),
+           netplay_.isDesynced() ? ", games DIFFERED" : "");
+  }
+  if (capture_.isStarted() && capture_.stop()) {
+    printf("Captured %d frames (%d dropped) to '%s'.\n", capture_.getNumFramesWritten(),
+           capture_.getNumFramesDropped(), options_.capturePath);
+  }
   return true;
 }
 
-void Game::gameOver(bool isWin)
+Uint64 Game::recordPhase(FramePhase phase, Uint64 phaseStart)
 {
-  isGameOver_ = true;
-  isGameOverWin_ = isWin;
-  
-  // TODO: Set up game state so that we can reset and restart the level.
+  Uint64 now = SDL_GetPerformanceCounter();
+  Uint64 micros = ((now - phaseStart) * 1000000) / SDL_GetPerformanceFrequency();
+  phaseHistograms_[phase].record((micros > UINT32_MAX) ? UINT32_MAX : (uint32_t)micros);
+  return now;
 }
 
-bool Game::isCollidingWithActor(Actor *actorA, Actor *actorB)
+void Game::printFrameSummary()
 {
-//  if (actorA == pacman_ || actorB == pacman_) return false;
-  int aTileX = actorA->getTileX();
-  int aTileY = actorA->getTileY();
-  int bTileX = actorB->getTileX();
-  int bTileY = actorB->getTileY();
-  
-  return (aTileX == bTileX && aTileY == bTileY);
+  printf("Frame phase timings over %llu frames, in microseconds:\n",
+         (unsigned long long)phaseHistograms_[PHASE_POLL].getCount());
+  printf("  %-8s%8s%8s%8s%8s\n", "phase", "p50", "p95", "p99", "max");
+  for (int i = 0; i < NUM_PHASES; i++) {
+    Histogram *histogram = &phaseHistograms_[i];
+    printf("  %-8s%8u%8u%8u%8u\n", PHASE_NAMES[i],
+           histogram->getPercentile(50), histogram->getPercentile(95),
+           histogram->getPercentile(99), histogram->getMax());
+  }
+  printf("Simulation thread tick timings over %llu ticks, in microseconds (%d stalls):\n",
+         (unsigned long long)tickHistogram_.getCount(), numStalls_);
+  printf("  %-8s%8u%8u%8u%8u\n", "TICK",
+         tickHistogram_.getPercentile(50), tickHistogram_.getPercentile(95),
+         tickHistogram_.getPercentile(99), tickHistogram_.getMax());
+  printf("Input latency over %llu key presses, in microseconds (%s input):\n",
+         (unsigned long long)inputToTickHistogram_.getCount(),
+         (options_.lowLatencyInput) ? "low latency" : "per frame");
+  Histogram *latencies[2] = { &inputToTickHistogram_, &inputToPresentHistogram_ };
+  const char *latencyNames[2] = { "TICK", "PRESENT" };
+  for (int i = 0; i < 2; i++) {
+    printf("  %-8s%8u%8u%8u%8u\n", latencyNames[i],
+           latencies[i]->getPercentile(50), latencies[i]->getPercentile(95),
+           latencies[i]->getPercentile(99), latencies[i]->getMax());
+  }
+  printf("Heap allocations while taking snapshots and drawing frames: %lu (should be 0).\n",
+         numFrameAllocations_);
 }
 
-bool Game::isCollidingWithTile(Actor *actor, int tileX, int tileY)
+void Game::recordLatency(Histogram *histogram, Uint64 since)
 {
-  // How far away the top side of the actor is from the top of the screen.
-  int topActor = actor->getY();
-  // How far away the bottom side of the actor is from the top of the screen.
-  int botActor = topActor + TILE_SIZE;
-  // How far away the left side of the actor is from the left of the screen.
-  int leftActor = actor->getX();
-  // How far away the right side of the actor is from the left of the screen.
-  int rightActor = leftActor + TILE_SIZE;
-  
-  // How far away the top side of the tile is from the top of the screen.
-  int topTile = (tileY * TILE_SIZE);
-  // How far away the bottom side of the tile is from the top of the screen.
-  int botTile = topTile + TILE_SIZE;
-  // How far away the left side of the tile is from the left of the screen.
-  int leftTile = (tileX * TILE_SIZE);
-  // How far away the right side of the tile is from the left of the screen.
-  int rightTile = leftTile + TILE_SIZE;
-  
-  if (botActor <= topTile) return false;
-  if (botTile <= topActor) return false;
-  
-  if (rightActor <= leftTile) return false;
-  if (rightTile <= leftActor) return false;
-  
-  return true;
+  Uint64 now = SDL_GetPerformanceCounter();
+  Uint64 micros = (now > since) ? ((now - since) * 1000000) / SDL_GetPerformanceFrequency() : 0;
+  histogram->record((micros > UINT32_MAX) ? UINT32_MAX : (uint32_t)micros);
 }
 
-bool Game::movePacmanForwardWithCollision()
+Uint64 Game::getKeyDownTime(const SDL_KeyboardEvent &key)
 {
-  bool success = true;
-  // TODO: Use, WHERE IS PACMAN WITHIN THE TILE IT IS IN?, to detect if collision.
-  //
-  // First try move PACMAN forward without worrying about collision.
-  pacman_->moveForward();
-  
-  // Which tile is the center of PACMAN now on?
-  int pacmanX = pacman_->getTileX();
-  int pacmanY = pacman_->getTileY();
-  TileType tile;
+  if (key.repeat != 0) {
+    return 0;
+  }
+  // Event timestamps are in SDL_GetTicks() milliseconds, so work out how
+  // long ago that was, and go back that far on the performance counter.
+  Uint64 now = SDL_GetPerformanceCounter();
+  Uint32 ageMs = SDL_GetTicks() - key.timestamp;
+  Uint64 age = ((Uint64)ageMs * SDL_GetPerformanceFrequency()) / 1000;
+  return (age < now) ? now - age : 1;
+}
 
-  // Get all the tiles surrounding that tile.
-  for (int i = -1; i <= 1; i++) {
-    for (int j = -1; j <= 1; j++) {
-      // And check if any are walls.
-      if (pacmanX + i < 0 || pacmanX + i > boardWidth_ - 1 ||
-          pacmanY + j < 0 || pacmanY + j > boardHeight_ - 1) {
-          continue;
+void Game::pollInput(bool *quit)
+{
+  SDL_Event event;
+  while (SDL_PollEvent(&event) != 0) {
+    if (event.type == SDL_QUIT) {
+      // User requests to quit.
+      *quit = true;
+    } else if (event.type == SDL_RENDER_TARGETS_RESET ||
+               event.type == SDL_RENDER_DEVICE_RESET) {
+      // Some backends throw away what was drawn into render targets.
+      if (mazeTexture_ != NULL && !buildMazeTexture()) {
+        printf("Failed to rebuild maze cache! SDL Error: %s\n", SDL_GetError());
+      }
+      isFrameTextureStale_ = true;
+    } else if (event.type == SDL_KEYDOWN) {
+      // User requests to change direction. If user inputted more
+      // than one direction, we will store only the most recent one.
+      Direction direction = DIRECTION_NONE;
+      switch (event.key.keysym.sym) {
+        case SDLK_UP:
+          direction = DIRECTION_UP;
+          break;
+        case SDLK_DOWN:
+          direction = DIRECTION_DOWN;
+          break;
+        case SDLK_LEFT:
+          direction = DIRECTION_LEFT;
+          break;
+        case SDLK_RIGHT:
+          direction = DIRECTION_RIGHT;
+          break;
+        case SDLK_F1:
+          // Toggle performance overlay.
+          isOverlayVisible_ = !isOverlayVisible_;
+          overlay_.update(phaseHistograms_, PHASE_NAMES, NUM_PHASES);
+          break;
+        default:
+          break;
+      }
+      if (direction != DIRECTION_NONE) {
+        input_ = packInput(direction, getKeyDownTime(event.key));
       }
-      tile = board_[pacmanX + i][pacmanY + j];
-      if (isCollidingWithTile(pacman_, pacmanX + i, pacmanY + j)) {
-        // Resolve collision.
-        if (tile == TILE_WALL) {
-          success = false;
+    } else if (event.type == SDL_KEYUP) {
+      switch (event.key.keysym.sym) {
+        case SDLK_UP:
+        case SDLK_DOWN:
+        case SDLK_LEFT:
+        case SDLK_RIGHT:
+          // Clear turn buffer, on the next tick.
+          isTurnBufferCleared_ = true;
           break;
-        } else if (tile == TILE_GATE) {
-          success = false;
+        default:
           break;
-        }
       }
     }
   }
-  
-  // If none of the tiles are walls, then successfully moved.
-  if (success) for (int i = -1; i <= 1; i++) for (int j = -1; j <= 1; j++) {
-    // Check if any of the tiles are pellets, power pellets, and so on.
-    int tileX = pacmanX + i;
-    int tileY = pacmanY + j;
-    if (pacmanX + i < 0 || pacmanX + i > boardWidth_ - 1 ||
-        pacmanY + j < 0 || pacmanY + j > boardHeight_ - 1) {
+}
+
+void Game::simulationLoop()
+{
+  // Ticks are due at fixed points on the timeline, like frames, so
+  // however long frames take to draw or present, ticks keep exact time.
+  Uint64 frequency = SDL_GetPerformanceFrequency();
+  Uint64 firstTick = SDL_GetPerformanceCounter();
+  Uint64 tickIndex = 0;
+  while (!isStopping_) {
+    Uint64 nextTick = firstTick + (tickIndex * frequency) / options_.simulationRate;
+    nextTickTime_.store(nextTick, std::memory_order_relaxed);
+    Uint64 now = SDL_GetPerformanceCounter();
+    if (now < nextTick) {
+      waitUntil(nextTick);
       continue;
     }
-    tile = board_[tileX][tileY];
-    if (isCollidingWithTile(pacman_, tileX, tileY)) {
-      if (tile == TILE_PELLET) {
-        pellets_ += 1;
-        Actor *ghosts[4] = { blinky_, inky_, pinky_, clyde_ };
-        for (int i = 0; i < 4; i++) {
-          Actor *ghost = ghosts[i];
-          if (ghost->getWaitingPellets() > 0) {
-            ghost->setWaitingPellets(ghost->getWaitingPellets() - 1);
-          }
-        }
-        board_[pacmanX + i][pacmanY + j] = TILE_NONE;
-        if (pellets_ == totalPellets_) {
-          // PACMAN has collected all pellets.
-          gameOver(true);
-        }
-      } else if (tile == TILE_POWER_PELLET) {
-        // Power pellet last 6 seconds, 6000 milliseconds.
-        pacman_->setPower(6000 / FRAME_TIME);
-        board_[pacmanX + i][pacmanY + j] = TILE_NONE;
-        Actor *ghosts[4] = { blinky_, inky_, pinky_, clyde_ };
-        for (int i = 0; i < 4; i++) {
-          Actor *ghost = ghosts[i];
-          GHOST_STATE state = ghost->getState();
-          if (state == GHOST_CHASE || state == GHOST_SCATTER) {
-            ghost->setState(GHOST_FRIGHTENED);
-            frightenedGhostSprite_ = { .x = 0, .y = 0, .w = 48, .h = 48 };
-            ghost->turnAround();
-          }
-        }
-      } else if (tile == TILE_PORTAL) {
-        if (tileX * TILE_SIZE == pacman_->getX() &&
-            tileY * TILE_SIZE == pacman_->getY()) {
-          // We should be exactly in a portal.
-          if (tileX == portalOneX && tileY == portalOneY) {
-            pacman_->setTileX(portalTwoX);
-            pacman_->setTileY(portalTwoY);
-            pacman_->setDirection(DIRECTION_LEFT);
-          } else if (tileX == portalTwoX && tileY == portalTwoY) {
-            pacman_->setTileX(portalOneX);
-            pacman_->setTileY(portalOneY);
-            pacman_->setDirection(DIRECTION_RIGHT);
-          } else {
-            assert(!"We should be exactly in a portal...");
-          }
-        }
-      }
-    }
-  }
-  
-  if (!success) {
-    // If any of the tiles are walls, reverse PACMAN.
-    pacman_->moveBackward();
-  } else /* if (success) */ {
-    // Successfully moved. Check if crash with any ghosts.
-    Actor *ghosts[4] = { blinky_, inky_, pinky_, clyde_ };
-    for (int i = 0; i < 4; i++) {
-      Actor *ghost = ghosts[i];
-      if (isCollidingWithActor(pacman_, ghost)) {
-        // If Ghost is eaten, pass through it regardless of power.
-        if (ghost->getState() != GHOST_EATEN) {
-          // If Ghost is not eaten, PACMAN survives only if Ghost
-          // is Frightened, AND if PACMAN has remaining power left
-          // to eat the Ghost.
-          if (ghost->getState() == GHOST_FRIGHTENED && (pacman_->getPower() > 0)) {
-            ghost->setState(GHOST_EATEN);
-          } else {
-            gameOver(false);
-          }
-        }
-      }
+    
+    if (((now - nextTick) * options_.simulationRate) / frequency >= MAX_CATCH_UP_TICKS) {
+      // We stalled (machine busy, process suspended) for longer than we
+      // are willing to catch up on. Drop the rest, rather than
+      // fast-forwarding through seconds of gameplay the player never got
+      // to see, by starting the timeline again a few ticks back from now.
+      numStalls_++;
+      firstTick = now - ((MAX_CATCH_UP_TICKS - 1) * frequency) / options_.simulationRate;
+      tickIndex = 0;
     }
+    
+    tick();
+    publishSnapshot();
+    tickIndex++;
+    
+    Uint64 micros = ((SDL_GetPerformanceCounter() - now) * 1000000) / frequency;
+    tickHistogram_.record((micros > UINT32_MAX) ? UINT32_MAX : (uint32_t)micros);
   }
-  
-  return success;
 }
 
-bool Game::moveGhostForwardWithCollision(Actor *ghost)
+void Game::tick()
 {
-  bool success = true;
-  
-  // Move this ghost forward without worrying about collision.
-  ghost->moveForward();
+  // The newest direction inputted is used by the next tick only.
+  Uint64 input = input_.exchange(DIRECTION_NONE);
+  Direction direction = (Direction)(input & INPUT_DIRECTION_MASK);
+  Uint64 keyDownTime = input >> INPUT_DIRECTION_BITS;
+  if (isTurnBufferCleared_.exchange(false)) {
+    turnBuffer_ = DIRECTION_NONE;
+  }
   
-  // Which tile is the center of this ghost now on?
-  int ghostX = ghost->getTileX();
-  int ghostY = ghost->getTileY();
-  TileType tile;
-
-  // Get all the tiles surrounding that tile.
-  for (int i = -1; i <= 1; i++) {
-    for (int j = -1; j <= 1; j++) {
-      // And check if any are walls.
-      if (ghostX + i < 0 || ghostX + i > boardWidth_ - 1 ||
-          ghostY + j < 0 || ghostY + j > boardHeight_ - 1) {
-        continue;
-      }
-      tile = board_[ghostX + i][ghostY + j];
-      if (isCollidingWithTile(ghost, ghostX + i, ghostY + j)) {
-        // Resolve collision.
-        if (tile == TILE_WALL) {
-          success = false;
-          break;
-        } else if (tile == TILE_GATE) {
-          // Can pass through gate only:
-          GHOST_STATE state = ghost->getState();
-          if (state == GHOST_FINDING_SPOT || state == GHOST_FINDING_EXIT) {
-            // If are trying to enter or leave base.
-            success = true;
-          } else {
-            // Otherwise, is just a normal wall.
-            success = false;
-          }
-        }
-      }
-    }
+  // If user didn't input a new direction since last tick,
+  // take from the turn buffer.
+  if (direction == DIRECTION_NONE) {
+    direction = turnBuffer_;
   }
   
-  if (!success) {
-    // If any of the tiles are walls, reverse this ghost.
-    ghost->moveBackward();
-  } else {
-    // Successfully moved. Check if this ghost crashed into PACMAN.
-    if (isCollidingWithActor(ghost, pacman_)) {
-      // If Ghost is eaten, pass through it regardless of power.
-      if (ghost->getState() != GHOST_EATEN) {
-        // If Ghost is not eaten, PACMAN survives only if Ghost
-        // is Frightened, AND if PACMAN has remaining power left
-        // to eat the Ghost.
-        if (ghost->getState() == GHOST_FRIGHTENED && (pacman_->getPower() > 0)) {
-          ghost->setState(GHOST_EATEN);
-        } else {
-          gameOver(false);
-        }
-      }
-    }
-    // And if this ghost has been eaten, Check if they have returned home.
-    if (ghost->getState() == GHOST_EATEN) {
-      if (ghost->getX() == (blinky_->getStartTileX() * TILE_SIZE) + (TILE_SIZE / 2) &&
-          ghost->getY() == blinky_->getStartTileY() * TILE_SIZE) {
-        // Ghost has arrived at the entrace of the homebase, Ghost is
-        // no longer eaten. Instead, is now entering the homebase to
-        // find its appropriate spot in the base. Once have arrived at
-        // that spot, will then immediately start to escape, find exit.
-        ghost->setState(GHOST_FINDING_SPOT);
-      }
-    }
-    
-    // If this ghost is in a portal, check if they are exactly in the portal.
-    int ghostTileX = ghost->getTileX();
-    int ghostTileY = ghost->getTileY();
-    if (board_[ghostTileX][ghostTileY] == TILE_PORTAL) {
-      if (ghostTileX * TILE_SIZE == ghost->getX() &&
-          ghostTileY * TILE_SIZE == ghost->getY()) {
-        // We should be exactly in a portal.
-        if (ghostTileX == portalOneX && ghostTileY == portalOneY) {
-          ghost->setTileX(portalTwoX);
-          ghost->setTileY(portalTwoY);
-        } else if (ghostTileX == portalTwoX && ghostTileY == portalTwoY) {
-          ghost->setTileX(portalOneX);
-          ghost->setTileY(portalOneY);
-        } else {
-          assert(!"We should be exactly in a portal...");
-        }
-      }
+  // Update our simulation by one tick.
+  if (options_.recordPath != NULL) {
+    recording_.addTick(direction);
+  }
+  if (netplay_.isStarted()) {
+    // Whether PACMAN turned isn't known for sure until the peer's input
+    // for this tick is, so keep sending the direction until the key is
+    // let go of. For the ghost, that is the direction it is steered in.
+    if (direction != DIRECTION_NONE) {
+      turnBuffer_ = direction;
     }
+    netplay_.advance(direction);
+  } else if (!simulation_->update(direction)) {
+    // Failed to update PACMAN to new direction.
+    // Remember the direction, will use in future ticks
+    // if user doesn't input a direction on those ticks.
+    turnBuffer_ = direction;
   }
   
-  return success;
+  // A key was just pressed, and this is the tick it made it into.
+  if (keyDownTime != 0) {
+    inputTime_ = keyDownTime;
+    recordLatency(&inputToTickHistogram_, keyDownTime);
+  }
 }
 
-void Game::setChaseOrScatter(Actor *ghost)
+void Game::publishSnapshot()
 {
-  if (currentMode_ == false) {
-    ghost->setState(GHOST_SCATTER);
-  } else {
-    ghost->setState(GHOST_CHASE);
-  }
+  Snapshot *snapshot = snapshots_.getBack();
+  takeSnapshot(simulation_, snapshot);
+  snapshot->inputTime = inputTime_;
+  snapshots_.publish();
 }
 
-void Game::moveGhost(Actor *ghost, int targetTileX, int targetTileY)
+void Game::waitUntil(Uint64 deadline)
 {
-  ghost->setTargetTileX(targetTileX);
-  ghost->setTargetTileY(targetTileY);
-  int ghostTileX = ghost->getTileX();
-  int ghostTileY = ghost->getTileY();
-
-  // At the start of game, waiting until can start to leave home.
-  if (ghost->getWaitingPellets() == 0) {
-    // Start to leave home!
-    ghost->setState(GHOST_FINDING_EXIT);
-    ghost->setWaitingPellets(-1);
-  } else if (ghost->getWaitingPellets() > 0){
-    // Continue going forward and back, bouncing
-    // against walls while waiting to leave base.
-    if (!moveGhostForwardWithCollision(ghost)) {
-      ghost->turnAround();
-      moveGhostForwardWithCollision(ghost);
+  Uint64 frequency = SDL_GetPerformanceFrequency();
+  Uint64 spinWindow = (frequency * SPIN_WINDOW_US) / 1000000;
+  Uint64 now = SDL_GetPerformanceCounter();
+  
+  // SDL_Delay only has ms resolution and may oversleep, so only
+  // sleep while we are comfortably far away from the deadline...
+  while (now + spinWindow < deadline) {
+    Uint32 ms = (Uint32)(((deadline - spinWindow - now) * 1000) / frequency);
+    if (ms == 0) {
+      break;
     }
-    return;
+    SDL_Delay(ms);
+    now = SDL_GetPerformanceCounter();
   }
   
-  assert(ghost->getWaitingPellets() == -1);
-  
-  GHOST_STATE state = ghost->getState();
-  if (state == GHOST_FINDING_EXIT) {
-    // Ghost is looking for exit.
-    if (ghost->getX() == (blinky_->getStartTileX() * TILE_SIZE) + (TILE_SIZE / 2)
-        &&
-       (ghost->getY() == blinky_->getStartTileY() * TILE_SIZE)) {
-      // Finished walking out of the base.
-      setChaseOrScatter(ghost);
-    } else if (ghost->getX() != (blinky_->getStartTileX() * TILE_SIZE) + (TILE_SIZE / 2)) {
-      // If are not aligned with the gates, then continue
-      // walking left/right until are aligned with the gates.
-      if (ghost->getX() < (blinky_->getStartTileX() * TILE_SIZE) + (TILE_SIZE / 2)) {
-        ghost->setDirection(DIRECTION_RIGHT);
-      } else {
-        ghost->setDirection(DIRECTION_LEFT);
-      }
-      moveGhostForwardWithCollision(ghost);
-    } else /* if (ghost->getX() == (blinky_->getStartTileX() * TILE_SIZE) + (TILE_SIZE / 2)) */ {
-      // If are aligned with the gates, then continue walking
-      // up until have left the gates left the base.
-      ghost->setDirection(DIRECTION_UP);
-      moveGhostForwardWithCollision(ghost);
-    }
-  } else if (state == GHOST_FINDING_SPOT) {
-    // Ghost is looking for their spot within the home base.
-    if (ghost->getX() == ghost->getSpotInBaseX() &&
-        ghost->getY() == ghost->getSpotInBaseY()) {
-      // Have reached their spot in base. From next
-      // frame onwards start looking for exit again.
-      ghost->setState(GHOST_FINDING_EXIT);
-    } else if (ghost->getY() != pinky_->getSpotInBaseY()) {
-      // Ghost is aiming for pinky's height.
-      ghost->setDirection(DIRECTION_DOWN);
-      moveGhostForwardWithCollision(ghost);
-    } else {
-      // Once at pinky's height, just move left or right until reach spot.
-      if (ghost->getSpotInBaseX() < pinky_->getSpotInBaseX()) {
-        ghost->setDirection(DIRECTION_LEFT);
-      } else {
-        ghost->setDirection(DIRECTION_RIGHT);
-      }
-      moveGhostForwardWithCollision(ghost);
-    }
-  } else if (state == GHOST_FRIGHTENED) {
-    if (ghost->getX() == ghostTileX * TILE_SIZE &&
-        ghost->getY() == ghostTileY * TILE_SIZE) {
-      // FIXME: can be not exactly in a tile and will have to choose next direction to turn.
-      // We are exactly on a tile. Make sure we are at an intersection.
-      // If are at an intersection, then randomly choose a direction to turn,
-      // either left, right, or continue forward.
-      Direction oldDirection = ghost->getDirection();
-      Direction newDirection = DIRECTION_NONE;
-      int dx[4] = { 0, 0, -1, 1 };
-      int dy[4] = { -1, 1, 0, 0 };
-      std::vector<Direction> directions;
-      for (int i = 0; i < 4; i++) {
-        int adjacentX = ghostTileX + dx[i];
-        int adjacentY = ghostTileY + dy[i];
-        if (adjacentX < 0 || adjacentX > boardWidth_ - 1) continue;
-        if (adjacentY < 0 || adjacentY > boardHeight_ - 1) continue;
-        TileType adjacentTile = board_[adjacentX][adjacentY];
-        if (i == 0 && oldDirection != DIRECTION_DOWN && adjacentTile != TILE_GATE && adjacentTile != TILE_WALL) {
-          newDirection = DIRECTION_UP;
-          directions.push_back(newDirection);
-        } else if (i == 1 && oldDirection != DIRECTION_UP && adjacentTile != TILE_GATE && adjacentTile != TILE_WALL) {
-          newDirection = DIRECTION_DOWN;
-          directions.push_back(newDirection);
-        } else if (i == 2 && oldDirection != DIRECTION_RIGHT && adjacentTile != TILE_GATE && adjacentTile != TILE_WALL) {
-          newDirection = DIRECTION_LEFT;
-          directions.push_back(newDirection);
-        } else if (i == 3 && oldDirection != DIRECTION_LEFT && adjacentTile != TILE_GATE && adjacentTile != TILE_WALL) {
-          newDirection = DIRECTION_RIGHT;
-          directions.push_back(newDirection);
-        }
-      }
-      while (directions.size() != 0) {
-        int randomIndex = rand() % directions.size();
-        Direction randomDirection = directions.at(randomIndex);
-        ghost->setDirection(randomDirection);
-        if (moveGhostForwardWithCollision(ghost)) {
-          // Successfully moved forward, so current direction is a valid direction.
-          break;
-        } else {
-          // Current direction leads to a wall, is not a valid direction.
-          // Remove from list so that on next iteration of loop
-          // this direction is not considered as a valid direction.
-          directions.erase(directions.begin() + randomIndex);
-        }
-      }
-    } else {
-      // Not at an intersection. Keep moving forward until are at an intersection.
-      moveGhostForwardWithCollision(ghost);
-    }
-  } else {
-    // Case for if scatter or chase or eaten.
-    bool justFlipped = false;
-    
-    // Checking if this ghost should transition between
-    // the Chase/Scatters state on this frame.
-    // If the ghost does change state on this frame,
-    // then we will also flip them around.
-    if (ghost->getState() == GHOST_SCATTER) {
-      setChaseOrScatter(ghost);
-      if (ghost->getState() == GHOST_CHASE) {
-        ghost->turnAround();
-        justFlipped = true;
-      }
-    } else if (ghost->getState() == GHOST_CHASE) {
-      setChaseOrScatter(ghost);
-      if (ghost->getState() == GHOST_SCATTER) {
-        ghost->turnAround();
-        justFlipped = true;
-      }
-    }
-    
-    // Follow the given target tile, provided by caller.
-    // If Ghost has just flipped, then we shouldn't calculate a new direction;
-    // The direction we just flipped to should be the direction we are headed,
-    // rather than any direction related to reaching the given target tile.
-    if (justFlipped == false ||
-       (ghost->getX() == ghostTileX * TILE_SIZE &&
-          ghost->getY() == ghostTileY * TILE_SIZE) ||
-       (ghost->getX() == (blinky_->getStartTileX() * TILE_SIZE) + (TILE_SIZE / 2) &&
-          ghost->getY() == blinky_->getStartTileY() * TILE_SIZE)) {
-      // If have arrived completely into a new tile, so are exactly in
-      // the tile that they are in right now, Or, If are right outside
-      // the front gates of the home base, which is where Blinky starts,
-      Direction oldDirection = ghost->getDirection();
-      Direction newDirection = DIRECTION_NONE;
-      std::vector<std::pair<float, Direction>> directions;
-      int dx[4] = { 0, 0, -1, 1 };
-      int dy[4] = { -1, 1, 0, 0 };
-      for (int i = 0; i < 4; i++) {
-        float distanceFromAdjacentTile =
-          sqrt(pow(ghostTileX + dx[i] - targetTileX, 2) +
-               pow(ghostTileY + dy[i] - targetTileY, 2));
-        if (i == 0 && oldDirection != DIRECTION_DOWN) {
-          newDirection = DIRECTION_UP;
-          directions.push_back(
-            std::make_pair(distanceFromAdjacentTile, newDirection));
-        } else if (i == 1 && oldDirection != DIRECTION_UP) {
-          newDirection = DIRECTION_DOWN;
-          directions.push_back(
-            std::make_pair(distanceFromAdjacentTile, newDirection));
-        } else if (i == 2 && oldDirection != DIRECTION_RIGHT) {
-          newDirection = DIRECTION_LEFT;
-          directions.push_back(
-            std::make_pair(distanceFromAdjacentTile, newDirection));
-        } else if (i == 3 && oldDirection != DIRECTION_LEFT) {
-          newDirection = DIRECTION_RIGHT;
-          directions.push_back(
-            std::make_pair(distanceFromAdjacentTile, newDirection));
-        }
-      }
-      std::sort(directions.begin(), directions.end());
-      for (auto vit = directions.begin(); vit != directions.end(); vit++) {
-        ghost->setDirection(vit->second);
-        if (moveGhostForwardWithCollision(ghost)) {
-          break;
-        }
-      }
-    } else {
-      // Otherwise, continue moving this ghost forward towards the tile
-      // in front of it. Will eventually be exactly in that tile.
-      moveGhostForwardWithCollision(ghost);
-    }
+  // ...and then busy-wait the last stretch on the high resolution counter.
+  while (now < deadline) {
+    now = SDL_GetPerformanceCounter();
   }
 }
 
-bool Game::update(Direction newDirection)
+void Game::waitSamplingInput(Uint64 deadline, bool *quit)
 {
-  /* No point updating if game is over. */
-  if (isGameOver_) {
-    return true;
-  }
-
-  bool success = true;
-  
-  /* First move PACMAN. */
-  
-  // Moving PACMAN.
-  Direction oldDirection = pacman_->getDirection();
-  if (newDirection == DIRECTION_NONE) {
-    success = movePacmanForwardWithCollision();
-  } else /* if (newDirection != DIRECTION_NONE) */ {
-    pacman_->setDirection(newDirection);
-    if (!movePacmanForwardWithCollision()) {
-      // There was a collision with a wall. Change back
-      // to old direction and try move forward again.
-      success = false;
-      pacman_->setDirection(oldDirection);
-      movePacmanForwardWithCollision();
-    }
-  }
-  
-  /* Then move the ghosts. */
-  
-  // Game starts when PACMAN starts moving. Don't
-  // move ghosts if PACMAN hasn't started moving.
-  if (pacman_->getDirection() == DIRECTION_NONE) {
-    currentMode_ = false; // Ghosts start off in Scatter mode.
-    currentModeIndex_ = 0;
-  } else /* if (pacman_->getDirection() != DIRECTION_NONE) */ {
-    if (!timer_->isRunning()) {
-      // We start the timer for the first time when we know
-      // for sure that Player has started controlling PACMAN.
-      timer_->start();
-    } else /* if (timer_->isRunning()) */ {
-      // Check if ghosts should be mode switching on this frame using timer.
-      if (modes_[currentModeIndex_] == -1) {
-        // Ghosts should be staying in chase mode on this frame.
-        currentMode_ = true;
-        printf("endless wave!\n");
-      } else if (timer_->getTimePassedSecs() > modes_[currentModeIndex_]) {
-        // Ghosts should switch to opposite mode on this frame.
-        currentModeIndex_++;
-        currentMode_ = !currentMode_;
-        printf("mode switch! ");
-        if (currentMode_) {
-          printf("chase!\n");
-        } else {
-          printf("scatter!\n");
-        }
-        // Re-Start timer to count how long the new mode should last.
-        timer_->stop();
-        timer_->start();
-      }
-    }
-    int pacmanTileX = pacman_->getTileX();
-    int pacmanTileY = pacman_->getTileY();
-    int targetTileX = pacmanTileX;
-    int targetTileY = pacmanTileY;
-    
-    // Moving Blinky. Target is directly where PACMAN is.
-    switch (blinky_->getState()) {
-    case GHOST_EATEN:
-      // Head back to the entrance of the home base,
-      // Which is where Blinky starts at start of game.
-      targetTileX = blinky_->getStartTileX();
-      targetTileY = blinky_->getStartTileY();
-      break;
-    case GHOST_SCATTER:
-      // Target the top right corner.
-      targetTileX = boardWidth_ - 3;
-      targetTileY = 0;
-      break;
-    case GHOST_CHASE:
-      // Head for PACMAN!
-      targetTileX = pacmanTileX;
-      targetTileY = pacmanTileY;
-      break;
-    case GHOST_FINDING_EXIT:
-      targetTileX = blinky_->getStartTileX();
-      targetTileX = blinky_->getStartTileY();
-      break;
-    case GHOST_FINDING_SPOT:
-      targetTileX = blinky_->getSpotInBaseX();
-      targetTileY = blinky_->getSpotInBaseY();
-      break;
-    default:
-      targetTileX = -1;
-      targetTileY = -1;
-    }
-    moveGhost(blinky_, targetTileX, targetTileY);
-    
-    // Moving Inky. Flanks PACMAN with Blinky.
-    switch (inky_->getState()) {
-    case GHOST_EATEN:
-      // Head back to the entrance of the home base,
-      // Which is where Blinky starts at start of game.
-      targetTileX = blinky_->getStartTileX();
-      targetTileY = blinky_->getStartTileY();
-    case GHOST_SCATTER:
-      // Target the bottom right corner.
-      targetTileX = boardWidth_ - 1;
-      targetTileY = boardHeight_ - 2;
-    case GHOST_FINDING_EXIT:
-      targetTileX = blinky_->getStartTileX();
-      targetTileX = blinky_->getStartTileY();
-      break;
-    case GHOST_FINDING_SPOT:
-      targetTileX = inky_->getSpotInBaseX();
-      targetTileY = inky_->getSpotInBaseY();
-      break;
-    default:
-      targetTileX = -1;
-      targetTileY = -1;
-    }
-    if (inky_->getState() == GHOST_CHASE) {
-      // Head for behind PACMAN so that we can flank PACMAN with Blinky!
-      // Get the tile two tiles in front of PACMAN, this will be the midpoint.
-      int midTileX = pacmanTileX;
-      int midTileY = pacmanTileY;
-      switch (pacman_->getDirection()) {
-      case DIRECTION_LEFT:
-        // Shift mX left two tiles.
-        midTileX -= 2;
-        break;
-      case DIRECTION_UP:
-        // Shift mY up two tiles.
-        midTileY -= 2;
-        break;
-      case DIRECTION_DOWN:
-        // Shift mY down two tiles.
-        midTileY += 2;
-        break;
-      case DIRECTION_RIGHT:
-        // Shift mX right two tiles.
-        midTileX += 2;
-        break;
-      default:
-        break;
-      }
-      // Get where blinky is.
-      int blinkyTileX = (blinky_->getX() + (TILE_SIZE / 2)) / TILE_SIZE;
-      int blinkyTileY = (blinky_->getY() + (TILE_SIZE / 2)) / TILE_SIZE;
-      
-      // Inky's target tile follows this math.
-      // Inky's target tile, the midpoint tile, and blinky's current tile,
-      // form a straight line segment, where the midpoint tile is equidistant
-      // from the other two tiles.
-      targetTileX = (2 * midTileX) - blinkyTileX;
-      targetTileY = (2 * midTileY) - blinkyTileY;
-    }
-    moveGhost(inky_, targetTileX, targetTileY);
-    
-    // Moving Pinky. Target is in front of PACMAN,
-    // So that we can attack PACMAN from in front.
-    switch (pinky_->getState()) {
-    case GHOST_EATEN:
-      // Head back to the entrance of the home base,
-      // Which is where Blinky starts at start of game.
-      targetTileX = blinky_->getStartTileX();
-      targetTileY = blinky_->getStartTileY();
-      break;
-    case GHOST_SCATTER:
-      // Target the top left corner.
-      targetTileX = 2;
-      targetTileY = 0;
-      break;
-    case GHOST_FINDING_EXIT:
-      targetTileX = blinky_->getStartTileX();
-      targetTileX = blinky_->getStartTileY();
-    case GHOST_FINDING_SPOT:
-      targetTileX = pinky_->getSpotInBaseX();
-      targetTileY = pinky_->getSpotInBaseY();
-    default:
-      targetTileX = -1;
-      targetTileY = -1;
-    }
-    if (pinky_->getState() == GHOST_CHASE) {
-      // Head for four tiles in front of PACMAN,
-      // so we can attack PACMAN from in front.
-      targetTileX = pacmanTileX;
-      targetTileY = pacmanTileY;
-      switch (pacman_->getDirection()) {
-        case DIRECTION_LEFT:
-          // Shift tX left four tiles.
-          targetTileX -= 4;
-          break;
-        case DIRECTION_UP:
-          // Shift tY up four tiles.
-          targetTileY -= 4;
-          break;
-        case DIRECTION_DOWN:
-          // Shift tY down four tiles.
-          targetTileY += 4;
-          break;
-        case DIRECTION_RIGHT:
-          // Shift tX right four tiles.
-          targetTileX += 4;
-          break;
-        default:
-          break;
-      }
-    }
-    moveGhost(pinky_, targetTileX, targetTileY);
-    
-    // Moving Clyde. Target is PACMAN, until get close
-    // then start running away into Clyde's corner.
-    switch (pinky_->getState()) {
-    case GHOST_EATEN:
-      // Head back to the entrance of the home base,
-      // Which is where Blinky starts at start of game.
-      targetTileX = blinky_->getStartTileX();
-      targetTileY = blinky_->getStartTileY();
-      break;
-    case GHOST_SCATTER:
-      // Target the bottom left corner.
-      targetTileX = 0;
-      targetTileY = boardHeight_ - 2;
+  Uint64 frequency = SDL_GetPerformanceFrequency();
+  Uint64 lead = (frequency * INPUT_LEAD_US) / 1000000;
+  Uint64 tickPeriod = frequency / options_.simulationRate;
+  Uint64 sampledTick = 0;
+  while (!*quit) {
+    // The simulation thread only moves on to its next tick once it has
+    // stepped this one, so after sampling for a tick, expect the next.
+    Uint64 nextTick = nextTickTime_.load(std::memory_order_relaxed);
+    if (nextTick <= sampledTick) {
+      nextTick = sampledTick + tickPeriod;
+    }
+    if (nextTick >= deadline) {
       break;
-    case GHOST_FINDING_EXIT:
-      targetTileX = blinky_->getStartTileX();
-      targetTileX = blinky_->getStartTileY();
-    case GHOST_FINDING_SPOT:
-      targetTileX = clyde_->getSpotInBaseX();
-      targetTileY = clyde_->getSpotInBaseY();
-    default:
-      targetTileX = -1;
-      targetTileY = -1;
-    }
-    if (clyde_->getState() == GHOST_CHASE) {
-      // Head for PACMAN, until we are within 8 tiles of
-      // distance from PACMAN, where we then start running
-      // away from PACMAN into our corner. PACMAN will be
-      // very confused!!!
-      int clydeTileX = clyde_->getTileX();
-      int clydeTileY = clyde_->getTileY();
-      int distanceFromPacman = (int)sqrt(pow(clydeTileX - pacmanTileX, 2) +
-                                         pow(clydeTileY - pacmanTileY, 2));
-      if (distanceFromPacman >= 8) {
-        // When far away from PACMAN, chase PACMAN.
-        targetTileX = pacmanTileX;
-        targetTileY = pacmanTileY;
-      } else {
-        // And when get close to PACMAN, run
-        // away from PACMAN into corner.
-        targetTileX = 0;
-        targetTileY = boardHeight_ - 2;
-      }
-    }
-    moveGhost(clyde_, targetTileX, targetTileY);
-  }
-  
-  // Frame is finished. Drain PACMAN of one frame of power.
-  if (pacman_->getPower() > 0) {
-    // If PACMAN has power left, reduce by one frame.
-    pacman_->setPower(pacman_->getPower() - 1);
-    // Flash frightened ghosts 3 times in the last 1.5 seconds.
-    if (pacman_->getPower() == (1500 / FRAME_TIME)) {
-      frightenedGhostSprite_ = { .x = 48, .y = 2 * 48, .w = 48, .h = 48 };
-    } else if (pacman_->getPower() == (1250 / FRAME_TIME)) {
-      frightenedGhostSprite_ = { .x = 0, .y = 0, .w = 48, .h = 48 };
-    } else if (pacman_->getPower() == (1000 / FRAME_TIME)) {
-      frightenedGhostSprite_ = { .x = 48, .y = 2 * 48, .w = 48, .h = 48 };
-    } else if (pacman_->getPower() == (750 / FRAME_TIME)) {
-      frightenedGhostSprite_ = { .x = 0, .y = 0, .w = 48, .h = 48 };
-    } else if (pacman_->getPower() == (500 / FRAME_TIME)) {
-      frightenedGhostSprite_ = { .x = 48, .y = 2 * 48, .w = 48, .h = 48 };
-    } else if (pacman_->getPower() == (250 / FRAME_TIME)) {
-      frightenedGhostSprite_ = { .x = 0, .y = 0, .w = 48, .h = 48 };
     }
-  }
-  if (pacman_->getPower() == 0) {
-    pacman_->setPower(-1);
-    // Pacman has run out of power,
-    // Un-Frighten all ghosts before next frame starts.
-    Actor *ghosts[4] = { blinky_, inky_, pinky_, clyde_ };
-    for (int i = 0; i < 4; i++) {
-      Actor *ghost = ghosts[i];
-      if (ghost->getState() == GHOST_FRIGHTENED) {
-        setChaseOrScatter(ghost);
-      }
+    if (nextTick > lead) {
+      waitUntil(nextTick - lead);
     }
+    pollInput(quit);
+    sampledTick = nextTick;
   }
-  
-  return success;
+  waitUntil(deadline);
 }
 
 void Game::render()
 {
-  // Clear buffer.
-  SDL_SetRenderDrawColor(renderer_, 0, 0, 0, 0xFF);
-  SDL_RenderClear(renderer_);
-  
-  // Draw board into buffer.
-  for (int j = 0; j < boardHeight_; j++) {
-    for (int i = 0; i < boardWidth_; i++) {
-      switch (board_[i][j]) {
-        case TILE_NONE:
-          break;
-        case TILE_WALL:
-          drawWall(i * TILE_SIZE, j * TILE_SIZE);
-          break;
-        case TILE_POWER_PELLET:
-          drawPowerPellet(i * TILE_SIZE, j * TILE_SIZE);
-          break;
-        case TILE_PELLET:
-          drawPellet(i * TILE_SIZE, j * TILE_SIZE);
-          break;
-        case TILE_GATE:
-          drawGate(i * TILE_SIZE, j * TILE_SIZE);
-          break;
-        case TILE_BASE:
-        case TILE_PORTAL:
-          break;
-        default:
-          printf("Render: Unexpected tile!\n");
-          break;
-      }
-    }
+  if (frameTexture_ != NULL) {
+    // Bring the previous frame up to date, and use that as this frame.
+    findDirtyRects();
+    SDL_SetRenderTarget(renderer_, frameTexture_);
+    for (int i = 0; i < numDirtyRects_; i++) {
+      SDL_RenderSetClipRect(renderer_, &dirtyRects_[i]);
+      drawScene(&dirtyRects_[i]);
+    }
+    SDL_RenderSetClipRect(renderer_, NULL);
+    SDL_SetRenderTarget(renderer_, NULL);
+    SDL_RenderCopy(renderer_, frameTexture_, NULL, NULL);
+  } else {
+    // Draw the whole frame from scratch.
+    drawScene(NULL);
   }
   
-  // Draw actors into buffer, on top of board.
-  drawPacman();
-  drawGhost(blinky_);
-  drawGhost(inky_);
-  drawGhost(pinky_);
-  drawGhost(clyde_);
-  
   // And draw game over text on top, if is game over.
   // TODO: Make the game over screen nicer.
-  if (isGameOver_) {
-    if (isGameOverWin_) {
+  if (snapshot_->isGameOver) {
+    if (snapshot_->isGameOverWin) {
       SDL_SetRenderDrawColor(renderer_, 0x00, 0x00, 0x00, 0xFF);
       SDL_RenderClear(renderer_);
     } else {
@@ -1171,280 +615,303 @@ void Game::render()
       SDL_RenderClear(renderer_);
     }
   }
-    
-  // Present buffer.
-  SDL_RenderPresent(renderer_);
   return;
 }
 
-/* Taking from the 48px spritesheet. */
-
-void Game::drawPacman() {
-  SDL_Rect srcrect = { .x = (4 * 48), .y = 48, .w = 48, .h = 48 };
-  if (pacmanAnimationFrame_ == 0) {
-    srcrect.x += (0 * 48);
-  } else if (pacmanAnimationFrame_ == 1) {
-    srcrect.x += (1 * 48);
-  }
-  double angle = 0;
-  if (pacman_->getDirection() == DIRECTION_UP) {
-    angle = 270;
-  } else if (pacman_->getDirection() == DIRECTION_DOWN) {
-    angle = 90;
-  } else if (pacman_->getDirection() == DIRECTION_LEFT) {
-    angle = 180;
-  } else if (pacman_->getDirection() == DIRECTION_RIGHT) {
-    angle = 0;
-  } else {
-    srcrect.x = (5 * 48);
-  }
-  drawSprite(&srcrect, pacman_->getX() - (TILE_SIZE / 2), pacman_->getY() - (TILE_SIZE / 2), angle);
-}
-
-void Game::drawGhost(Actor *ghost) {
-  // Drawing ghost sprite.
-  SDL_Rect srcrect = { .x = 0, .y = 48, .w = 48, .h = 48 };
-  if (ghost->getState() == GHOST_FRIGHTENED) {
-    // Draw frightened ghost sprite.
-    srcrect = frightenedGhostSprite_;
-    drawSprite(&srcrect, ghost->getX() - (TILE_SIZE / 2), ghost->getY() - (TILE_SIZE / 2));
-  } else if (ghost->getState() != GHOST_EATEN) {
-    // Draw normal ghost sprite.
-    if (ghost == blinky_) {
-      srcrect.x += (0 * 48);
-    } else if (ghost == inky_) {
-      srcrect.x += (1 * 48);
-    } else if (ghost == pinky_) {
-      srcrect.x += (2 * 48);
-    } else {
-      srcrect.x += (3 * 48);
-    }
-    drawSprite(&srcrect, ghost->getX() - (TILE_SIZE / 2), ghost->getY() - (TILE_SIZE / 2));
-  } else {
-    // Draw nothing.
+void Game::drawScene(SDL_Rect *region)
+{
+  SDL_Rect screen = {
+    .x = 0, .y = 0,
+    .w = TILE_SIZE * boardWidth_,
+    .h = TILE_SIZE * boardHeight_
+  };
+  if (region == NULL) {
+    region = &screen;
   }
   
-  // Drawing target tile on screen for debugging.
-  // FIXME: Remove me! Is buggy (target tile is wrong when ghost first leaving base).
-  srcrect = { .x = 0, .y = (2 * 48), .w = 24, .h = 24 };
-  if (ghost == blinky_) {
-    srcrect.x += (0 * 24);
-  } else if (ghost == inky_) {
-    srcrect.x += (1 * 24);
-  } else if (ghost == pinky_) {
-    srcrect.y += (1 * 24);
+  // Draw the maze into buffer, which also clears the buffer.
+  if (mazeTexture_ != NULL) {
+    SDL_RenderCopy(renderer_, mazeTexture_, region, region);
   } else {
-    srcrect.x += (1 * 24);
-    srcrect.y += (1 * 24);
+    SDL_SetRenderDrawColor(renderer_, 0, 0, 0, 0xFF);
+    SDL_RenderClear(renderer_);
+    drawMaze();
+  }
+  
+  // Draw remaining pellets into buffer, on top of maze.
+  int firstTileX = region->x / TILE_SIZE;
+  int firstTileY = region->y / TILE_SIZE;
+  int lastTileX = (region->x + region->w - 1) / TILE_SIZE;
+  int lastTileY = (region->y + region->h - 1) / TILE_SIZE;
+  for (int j = firstTileY; j <= lastTileY; j++) {
+    for (int i = firstTileX; i <= lastTileX; i++) {
+      TileType tile = (TileType)snapshot_->tiles[(j * boardWidth_) + i];
+      SpriteId sprite = getPelletSprite(tile, snapshot_->pelletAnimationFrame);
+      if (sprite != NUM_SPRITES) {
+        drawSprite(sprite, i * TILE_SIZE, j * TILE_SIZE);
+      }
+    }
   }
-  drawSprite(&srcrect, ghost->getTargetTileX() * TILE_SIZE, ghost->getTargetTileY() * TILE_SIZE);
   
-  // Drawing ghost eyes.
-  if (ghost->getState() != GHOST_FRIGHTENED) {
-    srcrect = { .x = 0, .y = 0, .w = 48, .h = 48 };
-    if (ghost->getDirection() == DIRECTION_UP) {
-      srcrect.x += (1 * 48);
-    } else if (ghost->getDirection() == DIRECTION_LEFT) {
-      srcrect.x += (3 * 48);
-    } else if (ghost->getDirection() == DIRECTION_RIGHT) {
-      srcrect.x += (4 * 48);
-    } else {
-      srcrect.x += (2 * 48);
+  // Draw actors into buffer, on top of board.
+  SDL_Rect spriteRect = getSpriteRect(snapshot_->pacman);
+  if (SDL_HasIntersection(&spriteRect, region)) {
+    drawPacman();
+  }
+  for (int i = 0; i < numGhosts_; i++) {
+    spriteRect = getSpriteRect(snapshot_->ghosts[i]);
+    SDL_Rect targetRect = getTargetTileRect(snapshot_->ghosts[i]);
+    if (SDL_HasIntersection(&spriteRect, region) || SDL_HasIntersection(&targetRect, region)) {
+      drawGhost(i);
     }
-    drawSprite(&srcrect, ghost->getX() - (TILE_SIZE / 2), ghost->getY() - (TILE_SIZE / 2));
   }
+  
+  // Actually draw everything queued above.
+  flushSprites();
 }
 
-/* Taking from the 24px spritesheet. */
+SDL_Rect Game::getSpriteRect(const ActorSnapshot &actor)
+{
+  // Actors are drawn twice as big as their hitbox, centered on their hitbox.
+  SDL_Rect rect = {
+    .x = actor.x - (TILE_SIZE / 2), .y = actor.y - (TILE_SIZE / 2),
+    .w = 2 * TILE_SIZE, .h = 2 * TILE_SIZE
+  };
+  return rect;
+}
 
-void Game::drawGate(int x, int y)
+SDL_Rect Game::getTargetTileRect(const ActorSnapshot &ghost)
 {
-  SDL_Rect srcrect = { .x = (5 * 48), .y = 24, .w = 24, .h = 24 };
-  drawSprite(&srcrect, x, y);
+  SDL_Rect rect = {
+    .x = ghost.targetTileX * TILE_SIZE, .y = ghost.targetTileY * TILE_SIZE,
+    .w = TILE_SIZE, .h = TILE_SIZE
+  };
+  return rect;
 }
 
-void Game::drawWall(int x, int y)
+bool Game::setupDirtyRects()
 {
-  SDL_Rect srcrect = { .x = (6 * 48), .y = 0, .w = 24, .h = 24 };
-  int tileX = x / TILE_SIZE; int tileY = y / TILE_SIZE;
-  
-  // Get the indices of all surrounding tiles.
-  
-  // The Top and Left tiles.
-  int topTileX = tileX; int topTileY = tileY - 1;
-  int leftTileX = tileX - 1; int leftTileY = tileY;
+  int boardWidth = boardWidth_;
+  int boardHeight = boardHeight_;
   
-  // The Top-Left tile.
-  int topLeftTileX = leftTileX; int topLeftTileY = topTileY;
-  
-  // The Bot and Right tiles.
-  int botTileX = tileX; int botTileY = tileY + 1;
-  int rightTileX = tileX + 1; int rightTileY = tileY;
-  
-  // The Bot-Right tile.
-  int botRightTileX = rightTileX; int botRightTileY = botTileY;
+  // Needs the maze to be cached, to be able to erase just part of the screen.
+  if (mazeTexture_ == NULL) {
+    return false;
+  }
   
-  // Remaining surrounding tiles.
-  int botLeftTileX = leftTileX; int botLeftTileY = botTileY;
-  int topRightTileX = rightTileX; int topRightTileY = topTileY;
+  // The previous frame, kept around so we only have to redraw what changed.
+  frameTexture_ = SDL_CreateTexture(renderer_, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
+                                    TILE_SIZE * boardWidth, TILE_SIZE * boardHeight);
+  if (frameTexture_ == NULL) {
+    return false;
+  }
   
-  // Make sure none are out of bounds.
-  assert(board_[0][3] == TILE_WALL);
+  // What each tile looked like when we last drew it.
+  drawnTiles_ = (TileType *)malloc(boardWidth * boardHeight * sizeof(TileType));
+  // Where each sprite was last drawn: PACMAN, and each ghost and its target tile.
+  drawnSpriteRects_ = (SDL_Rect *)malloc((1 + (2 * numGhosts_)) * sizeof(SDL_Rect));
+  if (drawnTiles_ == NULL || drawnSpriteRects_ == NULL) {
+    SDL_DestroyTexture(frameTexture_);
+    frameTexture_ = NULL;
+    return false;
+  }
+  // No tile has been drawn yet, so start from a value no tile has.
+  for (int i = 0; i < boardWidth * boardHeight; i++) {
+    drawnTiles_[i] = (TileType)-1;
+  }
   
-  int *arrayX[8] = { &topTileX, &leftTileX, &botTileX, &rightTileX, &topLeftTileX, &botLeftTileX, &topRightTileX, &botRightTileX };
-  int *arrayY[8] = { &topTileY, &leftTileY, &botTileY, &rightTileY, &topLeftTileY, &botLeftTileY, &topRightTileY, &botRightTileY };
+  isFrameTextureStale_ = true;
+  return true;
+}
 
-  for (int i = 0; i < 8; i++) {
-    int aX = *arrayX[i];
-    int aY = *arrayY[i];
-    if ((aX < 0) || (aX > boardWidth_ - 1)) {
-      (*arrayX[i]) = 0;
-      (*arrayY[i]) = 3;
-    }
-    if ((aY < 0) || (aY > boardHeight_ - 1)) {
-      (*arrayX[i]) = 0;
-      (*arrayY[i]) = 3;
+void Game::findDirtyRects()
+{
+  int boardWidth = boardWidth_;
+  int boardHeight = boardHeight_;
+  numDirtyRects_ = 0;
+  
+  if (isFrameTextureStale_) {
+    // Nothing in the previous frame can be trusted, redraw everything.
+    SDL_Rect screen = { .x = 0, .y = 0, .w = TILE_SIZE * boardWidth, .h = TILE_SIZE * boardHeight };
+    addDirtyRect(&screen);
+    isFrameTextureStale_ = false;
+  }
+  
+  // Erase every sprite where it was last frame...
+  for (int i = 0; i < numDrawnSpriteRects_; i++) {
+    addDirtyRect(&drawnSpriteRects_[i]);
+  }
+  
+  // ...and draw it where it is this frame.
+  numDrawnSpriteRects_ = 0;
+  drawnSpriteRects_[numDrawnSpriteRects_++] = getSpriteRect(snapshot_->pacman);
+  for (int i = 0; i < numGhosts_; i++) {
+    // Ghosts also draw their target tile.
+    drawnSpriteRects_[numDrawnSpriteRects_++] = getSpriteRect(snapshot_->ghosts[i]);
+    drawnSpriteRects_[numDrawnSpriteRects_++] = getTargetTileRect(snapshot_->ghosts[i]);
+  }
+  for (int i = 0; i < numDrawnSpriteRects_; i++) {
+    addDirtyRect(&drawnSpriteRects_[i]);
+  }
+  
+  // Redraw pellets that were eaten, and power pellets when they blink.
+  int pelletAnimationFrame = snapshot_->pelletAnimationFrame;
+  bool hasPelletBlinked = (pelletAnimationFrame != drawnPelletAnimationFrame_);
+  drawnPelletAnimationFrame_ = pelletAnimationFrame;
+  for (int y = 0; y < boardHeight; y++) {
+    for (int x = 0; x < boardWidth; x++) {
+      TileType tile = (TileType)snapshot_->tiles[(y * boardWidth_) + x];
+      TileType *drawnTile = &drawnTiles_[(y * boardWidth) + x];
+      if (tile != *drawnTile || (hasPelletBlinked && tile == TILE_POWER_PELLET)) {
+        SDL_Rect tileRect = { .x = x * TILE_SIZE, .y = y * TILE_SIZE, .w = TILE_SIZE, .h = TILE_SIZE };
+        addDirtyRect(&tileRect);
+        *drawnTile = tile;
+      }
     }
   }
+}
 
-  // Get the type of each surrounding tile.
-  TileType topTile = board_[topTileX][topTileY];
-  TileType botTile = board_[botTileX][botTileY];
-  TileType leftTile = board_[leftTileX][leftTileY];
-  TileType rightTile = board_[rightTileX][rightTileY];
-  
-  TileType topLeftTile = board_[topLeftTileX][topLeftTileY];
-  TileType botLeftTile = board_[botLeftTileX][botLeftTileY];
-  TileType topRightTile = board_[topRightTileX][topRightTileY];
-  TileType botRightTile = board_[botRightTileX][botRightTileY];
-  
-  bool success = false;
-  
-  /* See if this wall should be drawn as one of the corner tiles. */
-  
-  if (isWall(botTile)) {
-    // Checking for Top-Left corner wall and Top-Right corner wall.
-    if (isWall(rightTile)) {
-      // Is a Top-Left corner wall candidate. Check if it should be.
-      if (!isWall(botRightTile)) {
-        // Is a Top-Left corner wall!
-        success = true;
-        srcrect = { .x = (6 * 48), .y = 0, .w = 24, .h = 24 };
-      } else if (!isWall(topLeftTile) && !isWall(topTile) && !isWall(leftTile)) {
-        // Is a Top-Left corner wall!
-        success = true;
-        srcrect = { .x = (6 * 48), .y = 0, .w = 24, .h = 24 };
-      }
-    }
-    if (!success && isWall(leftTile)) {
-      // Is a Top-Right corner wall candidate. Check if it should be.
-      if (!isWall(botLeftTile)) {
-        // Is a Top-Right corner wall!
-        success = true;
-        srcrect = { .x = (6 * 48) + 24, .y = 0, .w = 24, .h = 24 };
-      } else if (!isWall(topRightTile) && !isWall(topTile) && !isWall(rightTile)) {
-        // Is a Top-Right corner wall!
-        success = true;
-        srcrect = { .x = (6 * 48) + 24, .y = 0, .w = 24, .h = 24 };
-      }
-    }
+void Game::addDirtyRect(SDL_Rect *rect)
+{
+  // Only the part of the rect that is on screen matters.
+  SDL_Rect screen = {
+    .x = 0, .y = 0,
+    .w = TILE_SIZE * boardWidth_,
+    .h = TILE_SIZE * boardHeight_
+  };
+  SDL_Rect dirtyRect;
+  if (!SDL_IntersectRect(rect, &screen, &dirtyRect)) {
+    return;
   }
   
-  if (!success && isWall(topTile)) {
-    // Checking for Bot-Left corner wall and Bot-Right corner wall.
-    if (isWall(rightTile)) {
-      // Is a Bot-Left corner wall candidate. Check if it should be.
-      if (!isWall(topRightTile)) {
-        // Is a Bot-Left corner wall!
-        success = true;
-        srcrect = { .x = (6 * 48), .y = 24, .w = 24, .h = 24 };
-      } else if (!isWall(botLeftTile) && !isWall(botTile) && !isWall(leftTile)) {
-        // Is a Bot-Left corner wall!
-        success = true;
-        srcrect = { .x = (6 * 48), .y = 24, .w = 24, .h = 24 };
-      }
-    }
-    if (!success && isWall(leftTile)) {
-      // Is a Bot-Right corner wall candidate. Check if it should be.
-      if (!isWall(topLeftTile)) {
-        // Is a Bot-Right corner wall!
-        success = true;
-        srcrect = { .x = (6 * 48) + 24, .y = 24, .w = 24, .h = 24 };
-      } else if (!isWall(botRightTile) && !isWall(botTile) && !isWall(rightTile)) {
-        // Is a Bot-Right corner wall!
-        success = true;
-        srcrect = { .x = (6 * 48) + 24, .y = 24, .w = 24, .h = 24 };
-      }
+  // Overlapping rects are merged, so nothing gets drawn twice.
+  for (int i = 0; i < numDirtyRects_; i++) {
+    if (SDL_HasIntersection(&dirtyRects_[i], &dirtyRect)) {
+      SDL_UnionRect(&dirtyRects_[i], &dirtyRect, &dirtyRects_[i]);
+      return;
     }
   }
   
-  /* See if this wall should be drawn as one of the edge tiles. */
+  if (numDirtyRects_ == MAX_DIRTY_RECTS) {
+    // Too many separate changes, cheaper to just redraw everything.
+    numDirtyRects_ = 1;
+    dirtyRects_[0] = screen;
+    return;
+  }
+  dirtyRects_[numDirtyRects_++] = dirtyRect;
+}
+
+/* Taking from the sprite atlas. */
+
+void Game::drawPacman() {
+  const ActorSnapshot &pacman = snapshot_->pacman;
+  drawSprite(getPacmanSprite(*snapshot_), pacman.x - (TILE_SIZE / 2), pacman.y - (TILE_SIZE / 2));
+}
+
+void Game::drawGhost(int i) {
+  const ActorSnapshot &ghost = snapshot_->ghosts[i];
   
-  if (!success) {
-    if (!isWall(leftTile) || !isWall(rightTile)) {
-      // Draw Left/Right edge wall tile.
-      srcrect = { .x = (7 * 48), .y = 24, .w = 24, .h = 24 };
-    } else {
-      // Draw Top/Bot edge wall tile.
-      srcrect = { .x = (7 * 48), .y = 0, .w = 24, .h = 24 };
-    }
+  // Drawing ghost sprite.
+  SpriteId sprite = getGhostSprite(*snapshot_, i);
+  if (sprite != NUM_SPRITES) {
+    drawSprite(sprite, ghost.x - (TILE_SIZE / 2), ghost.y - (TILE_SIZE / 2));
   }
   
-  drawSprite(&srcrect, x, y);
+  // Drawing target tile on screen for debugging.
+  // FIXME: Remove me! Is buggy (target tile is wrong when ghost first leaving base).
+  drawSprite(getGhostTargetSprite(i), ghost.targetTileX * TILE_SIZE, ghost.targetTileY * TILE_SIZE);
+  
+  // Drawing ghost eyes.
+  SpriteId eyes = getGhostEyesSprite(ghost);
+  if (eyes != NUM_SPRITES) {
+    drawSprite(eyes, ghost.x - (TILE_SIZE / 2), ghost.y - (TILE_SIZE / 2));
+  }
 }
 
-bool Game::isWall(TileType tile)
+void Game::drawWall(int x, int y, WallSprite sprite)
 {
-  return (tile == TILE_WALL || tile == TILE_GATE);
+  SpriteId id = getWallSpriteId(sprite);
+  if (id != NUM_SPRITES) {
+    drawSprite(id, x, y);
+  }
+}
+
+void Game::drawMaze()
+{
+  int boardWidth = boardWidth_;
+  int boardHeight = boardHeight_;
+  for (int j = 0; j < boardHeight; j++) {
+    for (int i = 0; i < boardWidth; i++) {
+      drawWall(i * TILE_SIZE, j * TILE_SIZE, wallSprites_[(j * boardWidth) + i]);
+    }
+  }
 }
 
-void Game::drawPellet(int x, int y)
+bool Game::resolveWallSprites(Level *level)
 {
-  SDL_Rect srcrect = { .x = (5 * 48), .y = 0, .w = 24, .h = 24 };
-  drawSprite(&srcrect, x, y);
+  int boardWidth = boardWidth_;
+  int boardHeight = boardHeight_;
+  wallSprites_ = (WallSprite *)malloc(boardWidth * boardHeight * sizeof(WallSprite));
+  if (wallSprites_ == NULL) {
+    printf("Failed to allocate memory for wall sprites!\n");
+    return false;
+  }
+  
+  for (int y = 0; y < boardHeight; y++) {
+    for (int x = 0; x < boardWidth; x++) {
+      wallSprites_[(y * boardWidth) + x] = level->getWallSprite(x, y);
+    }
+  }
+  return true;
 }
 
-void Game::drawPowerPellet(int x, int y)
+bool Game::buildMazeTexture()
 {
-  SDL_Rect srcrect = { .x = (5 * 48) + (24), .y = 0, .w = 24, .h = 24 };
-  if (pelletAnimationFrame_ == 0) {
-    srcrect.y += (0 * 24);
-  } else if (pelletAnimationFrame_ == 1) {
-    srcrect.y += (1 * 24);
+  if (mazeTexture_ == NULL) {
+    mazeTexture_ = SDL_CreateTexture(renderer_, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
+                                     TILE_SIZE * boardWidth_,
+                                     TILE_SIZE * boardHeight_);
+    if (mazeTexture_ == NULL) {
+      return false;
+    }
+  }
+  
+  // Draw the empty maze once into the texture rather than the screen.
+  if (SDL_SetRenderTarget(renderer_, mazeTexture_) != 0) {
+    SDL_DestroyTexture(mazeTexture_);
+    mazeTexture_ = NULL;
+    return false;
   }
-  drawSprite(&srcrect, x, y);
+  SDL_SetRenderDrawColor(renderer_, 0, 0, 0, 0xFF);
+  SDL_RenderClear(renderer_);
+  drawMaze();
+  flushSprites();
+  SDL_SetRenderTarget(renderer_, NULL);
+  return true;
 }
 
-/* Helper function to draw from different spritesheets. */
+/* Helper function to draw from the sprite atlas. */
 
-bool Game::drawSprite(SDL_Rect *clip, int x, int y, double angle)
+bool Game::drawSprite(SpriteId sprite, int x, int y)
 {
-  assert(clip != NULL);
+  assert(sprite >= 0 && sprite < NUM_SPRITES);
   
   bool success = true;
   
-  // Clip the spritesheet to get the sprite.
-  // The sprite is at (clip.x, clip.y) on the spritesheet.
-  // The width of the sprite is given by (clip.w, clip.h).
-  SDL_Rect srcrect = {
-    .x = clip->x, .y = clip->y,
-    .w = clip->w, .h = clip->h
-  };
-  
-  // And paste that sprite at the given (x,y) on the
-  // screen, stretched to be width w and height h.
-  SDL_Rect dstrect = {
-    .x = x, .y = y,
-    .w = clip->w, .h = clip->h
-  };
-  
-  // Copy the sprite into our renderer's buffer.
-  if (SDL_RenderCopyEx(renderer_, spritesheet_, &srcrect, &dstrect, angle, NULL, SDL_FLIP_NONE) != 0) {
+  // Clip the atlas to get the sprite, and queue that sprite to be
+  // pasted at the given (x,y) on the screen. It is copied into our
+  // renderer's buffer along with the rest of the batch on flushSprites().
+  const SpriteRect &rect = SPRITE_RECTS[sprite];
+  SDL_Rect clip = { .x = rect.x, .y = rect.y, .w = rect.w, .h = rect.h };
+  if (!spriteBatch_.add(&clip, x, y)) {
     success = false;
-    printf("Failed to render sprite at (%d,%d)! SDL Error: %s\n",
-           x, y, SDL_GetError());
+    printf("Failed to queue sprite at (%d,%d)!\n", x, y);
   }
   
   return success;
 }
 
+bool Game::flushSprites()
+{
+  return spriteBatch_.flush(renderer_);
+}
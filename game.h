@@ -2,27 +2,85 @@
 #define game_h
 
 #include <SDL2/SDL.h>
-#include <SDL2_image/SDL_image.h>
 #include <SDL2_ttf/SDL_ttf.h>
+#include <atomic>
+#include <thread>
 
 #include "actor.h"
+#include "allocations.h"
+#include "capture.h"
 #include "direction.h"
-#include "timer.h"
+#include "histogram.h"
+#include "level.h"
+#include "netplay.h"
+#include "overlay.h"
+#include "recording.h"
+#include "simulation.h"
+#include "snapshot.h"
+#include "spritebatch.h"
+#include "sprites.h"
+#include "triplebuffer.h"
+#include "wall.h"
 
+// The parts of a frame we time separately. The simulation is stepped
+// on its own thread, so isn't part of a frame.
 typedef enum {
-  TILE_NONE,
-  TILE_WALL,
-  TILE_PELLET,
-  TILE_POWER_PELLET,
-  TILE_PORTAL,
-  TILE_BASE,
-  TILE_GATE
-} TileType;
+  PHASE_POLL,     // Draining SDL's event queue.
+  PHASE_SNAPSHOT, // Taking the newest snapshot of the simulation.
+  PHASE_RENDER,   // Submitting draw calls into the back buffer.
+  PHASE_PRESENT,  // SDL_RenderPresent.
+  PHASE_CAPTURE,  // Queueing the frame to be written to video, if capturing.
+  PHASE_SLEEP,    // Waiting for the next frame to be due.
+  NUM_PHASES
+} FramePhase;
+
+// How the game should be run, e.g. from command line options.
+struct GameOptions {
+  // The simulation is stepped simulationRate times per second (e.g. 60,
+  // 120 or 240), and the screen is redrawn displayRate times per second.
+  // Speeds are per second of game time, so the game plays the same at any
+  // simulation rate, just more smoothly at higher ones.
+  int simulationRate = Simulation::DEFAULT_TICKS_PER_SECOND;
+  int displayRate = 60;
+  
+  // Use SDL's software renderer rather than a hardware accelerated one.
+  bool useSoftwareRenderer = false;
+  
+  // Only redraw the parts of the screen that changed since last frame.
+  bool useDirtyRects = false;
+  
+  // Seed for the simulation's random numbers. 0 picks one from the clock.
+  uint32_t seed = 0;
+  
+  // If set, record the session to this file on quitting, for replaying.
+  const char *recordPath = NULL;
+  
+  // If set, play this compiled level (see lvlc) instead of the default.
+  const char *levelPath = NULL;
+  
+  // How many ghosts to play against, see Simulation.
+  int numGhosts = Simulation::DEFAULT_NUM_GHOSTS;
+  
+  // If set, write every frame shown to this Y4M video, see FrameCapture,
+  // and either hold up the game or drop frames if writing falls behind.
+  const char *capturePath = NULL;
+  CaptureOverflow captureOverflow = CAPTURE_WAIT;
+  
+  // Poll for input again just before each tick that falls while waiting
+  // for the next frame, rather than only once at the start of a frame.
+  bool lowLatencyInput = false;
+  
+  // Play against someone else over the network, as PACMAN or as Blinky,
+  // see NetplaySession. Both sides need the same level, rates, seed and
+  // number of ghosts.
+  bool isNetplay = false;
+  NetplayOptions netplay;
+};
 
 class Game {
   public:
-    // Initialise game with default level.
-    Game();
+    // Initialise game with the level in options, or the default level.
+    Game(const GameOptions &options = GameOptions());
     ~Game();
     
     // Return whether game initialisation succeeded.
@@ -33,66 +91,125 @@ class Game {
     bool run();
     
   private:
-    void gameOver(bool isWin);
-  
-    bool isCollidingWithActor(Actor *actorA, Actor *actorB);
-  
-    bool isCollidingWithTile(Actor *actor, int tileX, int tileY);
-
+    // For timing the parts of drawing a frame on their own, see renderbench.cpp.
+    friend class GameBench;
+    
     /**
-     * Move PACMAN forward while accounting for collision
-     * within our game world.
-     *
-     * \Returns If PACMAN successfully moved forward.
+     * Drain SDL's event queue, remembering the most recent direction
+     * inputted until the next tick consumes it.
      */
-    bool movePacmanForwardWithCollision();
-
-    bool moveGhostForwardWithCollision(Actor *ghost);
+    void pollInput(bool *quit);
     
-    void moveGhost(Actor *ghost, int targetTileX, int targetTileY);
+    /**
+     * On the simulation thread: step the simulation at exactly
+     * simulationRate ticks per second, publishing a snapshot after every
+     * tick, until isStopping_ is set.
+     */
+    void simulationLoop();
     
     /**
-     * Use Timer to calculate if this ghost should be in Chase or Scatter mode.
+     * Step our simulation by one tick, with the direction inputted
+     * since last tick, or from the turn buffer if none was inputted.
      */
-    void setChaseOrScatter(Actor *ghost);
-
+    void tick();
+    
+    // Copy what is drawn of the simulation into the back snapshot,
+    // and publish it to the render thread.
+    void publishSnapshot();
+    
     /**
-     * Update our simulation by one frame:
-     *
-     * - The player wants PACMAN to change to the given direction on this
-     *   frame, and then move forward one step in the new direction.
-     *
-     * - If PACMAN is unable to move forward one step in the new direction,
-     *   then don't change to new direction, remain in old direction, and
-     *   move forward one step (if are able to) in the old direction.
-     *
-     * - If PACMAN does successfully change direction, the user wants
-     *   PACMAN to remain in this direction, until their next successful
-     *   request for a change in direction.
-     *
-     * \Returns If PACMAN successfully changed direction to the new direction.
+     * Sleep until shortly before the given performance counter value,
+     * then spin for the remainder, for sub-millisecond frame pacing.
      */
-    bool update(Direction newDirection);
-
+    void waitUntil(Uint64 deadline);
+    
+    /**
+     * As waitUntil(), but waking up to poll for input INPUT_LEAD_US before
+     * each tick of the simulation that is due before deadline, so keys
+     * pressed while waiting make it into the very next tick.
+     */
+    void waitSamplingInput(Uint64 deadline, bool *quit);
+    
+    /**
+     * When the key of the given event went down, by the performance
+     * counter, or 0 if it was held down rather than just pressed.
+     */
+    Uint64 getKeyDownTime(const SDL_KeyboardEvent &key);
+    
+    // Record the time from since until now in histogram.
+    void recordLatency(Histogram *histogram, Uint64 since);
+    
     /**
-     * Render the current state of our simulation to screen.
+     * Record how long the given phase took, from phaseStart until now.
+     * \Returns now, which is when the next phase starts.
+     */
+    Uint64 recordPhase(FramePhase phase, Uint64 phaseStart);
+    
+    // Print p50/p95/p99/max of every frame phase, and of input latency.
+    void printFrameSummary();
+    
+    /**
+     * Render the newest snapshot of our simulation into the back buffer.
+     * Caller presents the buffer to screen.
      */
     void render();
     
-    void drawGhost(Actor *ghost);
+    /**
+     * Draw the maze, pellets and actors that fall within the given
+     * region of the screen, or the whole screen if region is NULL.
+     * Caller is expected to have clipped drawing to the region.
+     */
+    void drawScene(SDL_Rect *region);
+    
+    // Where on screen the given actor's sprite is drawn.
+    SDL_Rect getSpriteRect(const ActorSnapshot &actor);
+    // Where on screen the given ghost's target tile is drawn.
+    SDL_Rect getTargetTileRect(const ActorSnapshot &ghost);
+    
+    /**
+     * Set up keeping the previous frame in frameTexture_, to only
+     * redraw what changed since. \Returns false if unable to.
+     */
+    bool setupDirtyRects();
+    
+    /**
+     * Work out which parts of the screen need redrawing this frame:
+     * where actors were and now are, eaten pellets, and power pellets
+     * if they blinked.
+     */
+    void findDirtyRects();
+    
+    // Mark the given part of the screen as needing to be redrawn.
+    void addDirtyRect(SDL_Rect *rect);
+    
+    void drawGhost(int i);
     void drawPacman();
     
-    void drawGate(int x, int y);
-    void drawWall(int x, int y);
-    bool isWall(TileType tile);
-    void drawPowerPellet(int x, int y);
-    void drawPellet(int x, int y);
+    // Draw the wall or gate sprite for a tile, if any.
+    void drawWall(int x, int y, WallSprite sprite);
+    
+    // Draw every wall and gate of the maze, but nothing else.
+    void drawMaze();
+    
+    // Take which sprite each wall and gate tile is drawn with from level.
+    bool resolveWallSprites(Level *level);
+    
+    /**
+     * Pre-render the walls and gates into mazeTexture_, so each frame
+     * only has to copy one texture to draw the maze.
+     * \Returns false if the renderer can't draw into textures.
+     */
+    bool buildMazeTexture();
     
     /**
-     * Clip the appropriate spritesheet using given clip,
-     * and draw that sprite at (x,y) on our window.
+     * Draw the given sprite from the atlas at (x,y) on our window.
+     *
+     * Sprites are only queued, to be drawn all at once by flushSprites().
      */
-    bool drawSprite(SDL_Rect *clip, int x, int y, double angle = 0);
+    bool drawSprite(SpriteId sprite, int x, int y);
+    
+    // Draw every sprite queued since last flush, in the order queued.
+    bool flushSprites();
 
     // Game initialisation success.
     bool success_;
@@ -100,48 +217,79 @@ class Game {
     // For drawing our simulation to screen.
     SDL_Window *window_;
     SDL_Renderer *renderer_;
-    SDL_Texture *spritesheet_;
-    
-    // Data structures for running our simulation.
-    TileType **board_;
-    Actor *pacman_;
-    Actor *blinky_;
-    Actor *inky_;
-    Actor *pinky_;
-    Actor *clyde_;
-    Timer *timer_;
-    int *modes_;           // How long to stay in each mode:
-    int currentModeIndex_; // Even indices is Scatter mode,
-                           // Odd indices is Chase mode.
-                           
-    // Member variables for running our simulation.
-    bool currentMode_;     // The current mode all out-of-base alive
-                           // ghosts should be in on this frame.
-                           // false is Scatter mode,
-                           // true is Chase mode.
+    SDL_Texture *spritesheet_; // The sprite atlas, see sprites.h.
+    SpriteBatch spriteBatch_;  // Sprites from spritesheet_ waiting to be drawn.
+    SDL_Texture *mazeTexture_; // Walls and gates, NULL if not cached.
+    WallSprite *wallSprites_;  // Per tile, row by row.
+    
+    // For only redrawing the parts of the screen that changed.
+    SDL_Texture *frameTexture_; // Previous frame, NULL if redrawing everything.
+    bool isFrameTextureStale_;  // Whether all of frameTexture_ needs redrawing.
+    TileType *drawnTiles_;      // Tiles as they were last drawn, row by row.
+    int drawnPelletAnimationFrame_;
+    SDL_Rect *drawnSpriteRects_; // Where sprites were last drawn, for PACMAN
+                                 // and for each ghost and its target tile.
+    int numDrawnSpriteRects_;
+    static const int MAX_DIRTY_RECTS = 32;
+    SDL_Rect dirtyRects_[MAX_DIRTY_RECTS];
+    int numDirtyRects_;
+    
+    // The simulation we are drawing, and feeding player input into.
+    // Only touched by the simulation thread while it is running.
+    Simulation *simulation_;
     int boardWidth_;
     int boardHeight_;
-    int pellets_;
-    int totalPellets_;
-    bool isGameOver_;
-    bool isGameOverWin_;
-    int portalOneX;
-    int portalOneY;
-    int portalTwoX;
-    int portalTwoY;
-
-    // For animations.
-    int pacmanAnimationFrame_;
-    int pacmanAnimationFrameCounter_;
-    int pelletAnimationFrame_;
-    int pelletAnimationFrameCounter_;
-    SDL_Rect frightenedGhostSprite_;
-    
-    // How long each frame should take in ms.
-    static const Uint32 FRAME_TIME = 16.7;
-    static const Uint32 TILE_SIZE = 24;
-    double averageFrameTime;
-    int numFramesPassed;
+    int numGhosts_;
+    
+    // The simulation thread publishes a snapshot after every tick, and
+    // the render thread draws whichever is newest when a frame starts.
+    std::thread simulationThread_;
+    TripleBuffer<Snapshot> snapshots_;
+    const Snapshot *snapshot_; // Being drawn, from snapshots_.getFront().
+    std::atomic<bool> isStopping_;
+    
+    GameOptions options_;
+    
+    // For feeding player input from the render thread into our simulation.
+    std::atomic<Uint64> input_;              // Inputted since last tick, if any,
+                                             // see packInput().
+    std::atomic<Uint64> nextTickTime_;       // When the next tick is due.
+    std::atomic<bool> isTurnBufferCleared_;  // Arrow key let go since last tick.
+    Direction turnBuffer_;                   // Simulation thread's.
+    Uint64 inputTime_;                       // Simulation thread's, when the key
+                                             // of the newest input used went down.
+    
+    // At most how many ticks to step at once when catching up after a stall.
+    static const Uint64 MAX_CATCH_UP_TICKS = 5;
+    // How long before a deadline to stop sleeping and start spinning, in microseconds.
+    static const Uint64 SPIN_WINDOW_US = 2000;
+    // How long before a tick to poll for input for it, in low latency mode.
+    static const Uint64 INPUT_LEAD_US = 500;
+    static const int TILE_SIZE = Simulation::TILE_SIZE;
+    
+    // For measuring where frame time goes.
+    static const char *PHASE_NAMES[NUM_PHASES];
+    Histogram phaseHistograms_[NUM_PHASES];
+    Histogram tickHistogram_;  // Simulation thread's, how long each tick took.
+    // From a key going down to the tick that used it (simulation thread's),
+    // and to presenting the first frame drawn from that tick (render thread's).
+    Histogram inputToTickHistogram_;
+    Histogram inputToPresentHistogram_;
+    Uint64 presentedInputTime_; // Render thread's, inputTime of the last frame presented.
+    int numStalls_;            // Times the simulation thread dropped ticks.
+    unsigned long numFrameAllocations_; // operator new calls, on either thread,
+                                        // while rendering. Should stay 0.
+    
+    // Every direction the simulation was updated with, if recording.
+    Recording recording_;
+    // Every frame shown, if capturing.
+    FrameCapture capture_;
+    // The peer, if playing over the network. Simulation thread's.
+    NetplaySession netplay_;
+    PerformanceOverlay overlay_;
+    bool isOverlayVisible_;
+    // How many frames between refreshes of the overlay's numbers.
+    static const Uint64 OVERLAY_REFRESH_FRAMES = 30;
 };
 
 #endif /* game_h */
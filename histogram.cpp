@@ -0,0 +1,82 @@
+#include "histogram.h"
+#include <string.h>
+
+Histogram::Histogram()
+{
+  clear();
+}
+
+Histogram::~Histogram() {}
+
+void Histogram::record(uint32_t micros)
+{
+  buckets_[getBucket(micros)]++;
+  count_++;
+  if (micros > max_) {
+    max_ = micros;
+  }
+}
+
+void Histogram::clear()
+{
+  memset(buckets_, 0, sizeof(buckets_));
+  count_ = 0;
+  max_ = 0;
+}
+
+uint64_t Histogram::getCount()
+{
+  return count_;
+}
+
+uint32_t Histogram::getMax()
+{
+  return max_;
+}
+
+uint32_t Histogram::getPercentile(double percentile)
+{
+  if (count_ == 0) {
+    return 0;
+  }
+  
+  // How many durations must be at or below the answer.
+  uint64_t rank = (uint64_t)((percentile / 100.0) * count_ + 0.5);
+  if (rank < 1) rank = 1;
+  if (rank > count_) rank = count_;
+  
+  uint64_t seen = 0;
+  for (int i = 0; i < NUM_BUCKETS; i++) {
+    seen += buckets_[i];
+    if (seen >= rank) {
+      // Never report more than what was actually recorded.
+      uint32_t floor = getBucketFloor(i);
+      return (floor < max_) ? floor : max_;
+    }
+  }
+  return max_;
+}
+
+int Histogram::getBucket(uint32_t micros)
+{
+  if (micros < NUM_LINEAR_BUCKETS) {
+    return micros;
+  }
+  
+  // Which power of two is this duration in (6 for [64, 128), and so on),
+  // and which sixteenth of that power of two.
+  int exponent = 31 - __builtin_clz(micros);
+  int subBucket = (micros >> (exponent - SUB_BUCKET_BITS)) & ((1 << SUB_BUCKET_BITS) - 1);
+  return NUM_LINEAR_BUCKETS + ((exponent - 6) << SUB_BUCKET_BITS) + subBucket;
+}
+
+uint32_t Histogram::getBucketFloor(int bucket)
+{
+  if (bucket < NUM_LINEAR_BUCKETS) {
+    return bucket;
+  }
+  
+  int exponent = ((bucket - NUM_LINEAR_BUCKETS) >> SUB_BUCKET_BITS) + 6;
+  int subBucket = (bucket - NUM_LINEAR_BUCKETS) & ((1 << SUB_BUCKET_BITS) - 1);
+  return ((uint32_t)1 << exponent) | ((uint32_t)subBucket << (exponent - SUB_BUCKET_BITS));
+}
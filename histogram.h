@@ -0,0 +1,50 @@
+#ifndef histogram_h
+#define histogram_h
+
+#include <stdint.h>
+
+/**
+ * Fixed-size histogram of durations in microseconds, for finding the
+ * tail latency of some repeated piece of work (e.g. one phase of a frame).
+ *
+ * Durations under 64us each get their own bucket. Above that, every power
+ * of two is split into 16 buckets, so reported percentiles are within
+ * about 6% of the real duration. Recording never allocates.
+ */
+class Histogram {
+  public:
+    Histogram();
+    ~Histogram();
+    
+    // Add one duration to the histogram.
+    void record(uint32_t micros);
+    
+    // Forget all recorded durations.
+    void clear();
+    
+    uint64_t getCount();
+    uint32_t getMax();
+    
+    /**
+     * Returns the duration that percentile% of recorded durations
+     * are less than or equal to, e.g. getPercentile(99) for p99.
+     * Returns 0 if nothing has been recorded.
+     */
+    uint32_t getPercentile(double percentile);
+    
+  private:
+    static int getBucket(uint32_t micros);
+    
+    // Smallest duration that would land in the given bucket.
+    static uint32_t getBucketFloor(int bucket);
+    
+    static const int NUM_LINEAR_BUCKETS = 64;
+    static const int SUB_BUCKET_BITS = 4;
+    static const int NUM_BUCKETS = NUM_LINEAR_BUCKETS + (32 - 6) * (1 << SUB_BUCKET_BITS);
+    
+    uint64_t buckets_[NUM_BUCKETS];
+    uint64_t count_;
+    uint32_t max_;
+};
+
+#endif /* histogram_h */
@@ -1,66 +1,576 @@
 #include <stdio.h>
-#include <string>
+#include <stdlib.h>
+#include <string.h>
+#include <array>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include "level.h"
-#include <cassert>
+#include "direction.h"
+
+static constexpr char MAGIC[4] = { 'P', 'M', 'L', 'V' };
+
+// The file is the header as held in memory, so it must have no padding.
+static_assert(sizeof(LevelActor) == 8 * 4 && sizeof(LevelHeader) == 52 * 4,
+              "LevelHeader must be laid out as in the file");
+
+// Largest level accepted, in tiles, so sizes can never overflow.
+static const int MAX_SIZE = 1024;
+
+/**
+ * Compile width x height characters of level text into a level laid out
+ * as in a level file: header, then tiles at tiles, then wall sprites at
+ * wallSprites. The caller sets where in the file those two are.
+ *
+ * constexpr, so that the default level is compiled along with the game.
+ *
+ * \Returns NULL, or what is wrong with the text, with the tile at fault
+ * in errorX and errorY (both -1 if it isn't any one tile).
+ */
+static constexpr const char *parseLevel(const char *text, int width, int height,
+                                        LevelHeader *header, uint8_t *tiles,
+                                        uint8_t *wallSprites, int *errorX, int *errorY)
+{
+  *errorX = -1;
+  *errorY = -1;
+  for (int i = 0; i < 4; i++) header->magic[i] = MAGIC[i];
+  header->version = Level::VERSION;
+  header->width = width;
+  header->height = height;
+  header->totalPellets = 0;
+  header->portalOneX = -1;
+  header->portalOneY = -1;
+  header->portalTwoX = -1;
+  header->portalTwoY = -1;
+  
+  // How each actor starts. Ghosts wait for more pellets the later they
+  // leave the base, and scatter to their own corner of the board.
+  LevelActor *actors = header->actors;
+  bool isFound[NUM_LEVEL_ACTORS] = { false };
+  const char actorChars[NUM_LEVEL_ACTORS] = { '0', 'b', 'i', 'p', 'c' };
+  const char *missingActors[NUM_LEVEL_ACTORS] = {
+    "Level has no PACMAN ('0')!", "Level has no Blinky ('b')!", "Level has no Inky ('i')!",
+    "Level has no Pinky ('p')!", "Level has no Clyde ('c')!"
+  };
+  const Direction directions[NUM_LEVEL_ACTORS] = {
+    DIRECTION_NONE, DIRECTION_LEFT, DIRECTION_UP, DIRECTION_DOWN, DIRECTION_UP
+  };
+  const int waitingPellets[NUM_LEVEL_ACTORS] = { 0, 0, 30, 10, 90 };
+  const int scatterTiles[NUM_LEVEL_ACTORS][2] = {
+    { -1, -1 },
+    { width - 3, 0 },          // Blinky, top right.
+    { width - 1, height - 2 }, // Inky, bottom right.
+    { 2, 0 },                  // Pinky, top left.
+    { 0, height - 2 }          // Clyde, bottom left.
+  };
+  
+  for (int y = 0; y < height; y++) {
+    for (int x = 0; x < width; x++) {
+      char c = text[(y * width) + x];
+      TileType tile = TILE_NONE;
+      switch (c) {
+        case '-':
+        case '0': // PACMAN. At start stands below the base.
+        case 'b': // Blinky. At start stands on a tile outside base,
+                  // The tile that all ghosts target to reach home.
+          tile = TILE_NONE;
+          break;
+        case '#':
+          tile = TILE_WALL;
+          break;
+        case 'x':
+          tile = TILE_PELLET;
+          header->totalPellets += 1;
+          break;
+        case 'y':
+          tile = TILE_POWER_PELLET;
+          break;
+        case '+': // Base.
+        case 'i': // Inky, Pinky and Clyde. At start stand inside base.
+        case 'p':
+        case 'c':
+          tile = TILE_BASE;
+          break;
+        case 'g': // Gate of base.
+          tile = TILE_GATE;
+          break;
+        case 't': // Teleport, Tunnel.
+          tile = TILE_PORTAL;
+          if (header->portalOneX == -1) {
+            header->portalOneX = x;
+            header->portalOneY = y;
+          } else if (header->portalTwoX == -1) {
+            header->portalTwoX = x;
+            header->portalTwoY = y;
+          } else {
+            *errorX = x;
+            *errorY = y;
+            return "Level has more than two portals!";
+          }
+          break;
+        default:
+          *errorX = x;
+          *errorY = y;
+          return "Unexpected character!";
+      }
+      tiles[(y * width) + x] = (uint8_t)tile;
+      
+      for (int i = 0; i < NUM_LEVEL_ACTORS; i++) {
+        // Only the first of each actor counts.
+        if (c != actorChars[i] || isFound[i]) continue;
+        isFound[i] = true;
+        actors[i].startTileX = x;
+        actors[i].startTileY = y;
+        actors[i].direction = directions[i];
+        actors[i].waitingPellets = waitingPellets[i];
+        // Blinky's spot is inside the base, three tiles below the gates.
+        actors[i].spotTileX = (i == LEVEL_PACMAN) ? -1 : x;
+        actors[i].spotTileY = (i == LEVEL_PACMAN) ? -1 : (i == LEVEL_BLINKY) ? y + 3 : y;
+        actors[i].scatterTileX = scatterTiles[i][0];
+        actors[i].scatterTileY = scatterTiles[i][1];
+      }
+    }
+  }
+  
+  for (int i = 0; i < NUM_LEVEL_ACTORS; i++) {
+    if (!isFound[i]) return missingActors[i];
+  }
+  if (header->portalOneX != -1 && header->portalTwoX == -1) {
+    return "Level has only one portal!";
+  }
+  
+  // Walls never change, so work out how to draw them once up front. The
+  // board is surrounded by walls, so tiles beyond the edge of the board
+  // join up with walls too.
+  auto getTile = [tiles, width, height](int x, int y) {
+    if (x < 0 || x >= width || y < 0 || y >= height) return TILE_WALL;
+    return (TileType)tiles[(y * width) + x];
+  };
+  for (int y = 0; y < height; y++) {
+    for (int x = 0; x < width; x++) {
+      wallSprites[(y * width) + x] = (uint8_t)getWallSprite(
+        getTile(x, y),
+        getTile(x, y - 1), getTile(x, y + 1),
+        getTile(x - 1, y), getTile(x + 1, y),
+        getTile(x - 1, y - 1), getTile(x + 1, y - 1),
+        getTile(x - 1, y + 1), getTile(x + 1, y + 1));
+    }
+  }
+  return NULL;
+}
+
+/* The default level, compiled along with the game. */
+
+static constexpr int DEFAULT_WIDTH = 28;
+static constexpr int DEFAULT_HEIGHT = 36;
+static constexpr int DEFAULT_TILES = DEFAULT_WIDTH * DEFAULT_HEIGHT;
+static constexpr char DEFAULT_LEVEL_TEXT[] =
+  "----------------------------"
+  "----------------------------"
+  "----------------------------"
+  "############################"
+  "#xxxxxxxxxxxx##xxxxxxxxxxxx#"
+  "#x####x#####x##x#####x####x#"
+  "#y#--#x#---#x##x#---#x#--#y#"
+  "#x####x#####x##x#####x####x#"
+  "#xxxxxxxxxxxxxxxxxxxxxxxxxx#"
+  "#x####x##x########x##x####x#"
+  "#x####x##x########x##x####x#"
+  "#xxxxxx##xxxx##xxxx##xxxxxx#"
+  "######x#####-##-#####x######"
+  "-----#x#####-##-#####x#-----"
+  "-----#x##----bb----##x#-----"
+  "-----#x##-###gg###-##x#-----"
+  "######x##-#++++++#-##x######"
+  "t-----x---#iippcc#---x-----t"
+  "######x##-#++++++#-##x######"
+  "-----#x##-########-##x#-----"
+  "-----#x##----------##x#-----"
+  "-----#x##-########-##x#-----"
+  "######x##-########-##x######"
+  "#xxxxxxxxxxxx##xxxxxxxxxxxx#"
+  "#x####x#####x##x#####x####x#"
+  "#x####x#####x##x#####x####x#"
+  "#yxx##xxxxxxx00xxxxxxx##xxy#"
+  "###x##x##x########x##x##x###"
+  "###x##x##x########x##x##x###"
+  "#xxxxxx##xxxx##xxxx##xxxxxx#"
+  "#x##########x##x##########x#"
+  "#x##########x##x##########x#"
+  "#xxxxxxxxxxxxxxxxxxxxxxxxxx#"
+  "############################"
+  "----------------------------"
+  "----------------------------";
+
+// Laid out exactly as a level file.
+struct DefaultLevelImage {
+  LevelHeader header;
+  std::array<uint8_t, DEFAULT_TILES> tiles;
+  std::array<uint8_t, DEFAULT_TILES> wallSprites;
+};
+static_assert(sizeof(DefaultLevelImage) == sizeof(LevelHeader) + (2 * DEFAULT_TILES),
+              "DefaultLevelImage must be laid out as a level file");
+
+struct DefaultLevel {
+  DefaultLevelImage image;
+  const char *error;
+  int errorX;
+  int errorY;
+};
+
+static constexpr DefaultLevel compileDefaultLevel()
+{
+  DefaultLevel level = {};
+  LevelHeader *header = &level.image.header;
+  level.error = parseLevel(DEFAULT_LEVEL_TEXT, DEFAULT_WIDTH, DEFAULT_HEIGHT, header,
+                           level.image.tiles.data(), level.image.wallSprites.data(),
+                           &level.errorX, &level.errorY);
+  header->fileSize = sizeof(DefaultLevelImage);
+  header->tilesOffset = sizeof(LevelHeader);
+  header->wallSpritesOffset = sizeof(LevelHeader) + DEFAULT_TILES;
+  return level;
+}
+
+static constexpr int countChars(const char *text, char c)
+{
+  int count = 0;
+  for (int i = 0; text[i] != '\0'; i++) count += (text[i] == c);
+  return count;
+}
+
+static constexpr DefaultLevel DEFAULT_LEVEL = compileDefaultLevel();
+
+// A broken default level fails the build, rather than the game at startup.
+static_assert(sizeof(DEFAULT_LEVEL_TEXT) - 1 == DEFAULT_TILES,
+              "The default level must be 28x36 tiles");
+static_assert(countChars(DEFAULT_LEVEL_TEXT, 't') == 2,
+              "The default level must have exactly two portals");
+static_assert(countChars(DEFAULT_LEVEL_TEXT, '0') > 0 && countChars(DEFAULT_LEVEL_TEXT, 'b') > 0 &&
+              countChars(DEFAULT_LEVEL_TEXT, 'i') > 0 && countChars(DEFAULT_LEVEL_TEXT, 'p') > 0 &&
+              countChars(DEFAULT_LEVEL_TEXT, 'c') > 0,
+              "The default level must have PACMAN ('0') and every ghost ('b', 'i', 'p', 'c')");
+static_assert(DEFAULT_LEVEL.error == NULL,
+              "The default level must compile, see parseLevel() for why not");
+static_assert(DEFAULT_LEVEL.image.header.totalPellets == 240,
+              "The default level has 240 pellets, as the arcade game");
 
 Level::Level()
 {
-  std::string defaultLevelText = "";
-  defaultLevelText += "----------------------------";
-  defaultLevelText += "----------------------------";
-  defaultLevelText += "----------------------------";
-  defaultLevelText += "############################";
-  defaultLevelText += "#xxxxxxxxxxxx##xxxxxxxxxxxx#";
-  defaultLevelText += "#x####x#####x##x#####x####x#";
-  defaultLevelText += "#y#--#x#---#x##x#---#x#--#y#";
-  defaultLevelText += "#x####x#####x##x#####x####x#";
-  defaultLevelText += "#xxxxxxxxxxxxxxxxxxxxxxxxxx#";
-  defaultLevelText += "#x####x##x########x##x####x#";
-  defaultLevelText += "#x####x##x########x##x####x#";
-  defaultLevelText += "#xxxxxx##xxxx##xxxx##xxxxxx#";
-  defaultLevelText += "######x#####-##-#####x######";
-  defaultLevelText += "-----#x#####-##-#####x#-----";
-  defaultLevelText += "-----#x##----bb----##x#-----";
-  defaultLevelText += "-----#x##-###gg###-##x#-----";
-  defaultLevelText += "######x##-#++++++#-##x######";
-  defaultLevelText += "t-----x---#iippcc#---x-----t";
-  defaultLevelText += "######x##-#++++++#-##x######";
-  defaultLevelText += "-----#x##-########-##x#-----";
-  defaultLevelText += "-----#x##----------##x#-----";
-  defaultLevelText += "-----#x##-########-##x#-----";
-  defaultLevelText += "######x##-########-##x######";
-  defaultLevelText += "#xxxxxxxxxxxx##xxxxxxxxxxxx#";
-  defaultLevelText += "#x####x#####x##x#####x####x#";
-  defaultLevelText += "#x####x#####x##x#####x####x#";
-  defaultLevelText += "#yxx##xxxxxxx00xxxxxxx##xxy#";
-  defaultLevelText += "###x##x##x########x##x##x###";
-  defaultLevelText += "###x##x##x########x##x##x###";
-  defaultLevelText += "#xxxxxx##xxxx##xxxx##xxxxxx#";
-  defaultLevelText += "#x##########x##x##########x#";
-  defaultLevelText += "#x##########x##x##########x#";
-  defaultLevelText += "#xxxxxxxxxxxxxxxxxxxxxxxxxx#";
-  defaultLevelText += "############################";
-  defaultLevelText += "----------------------------";
-  defaultLevelText += "----------------------------";
-  width_ = 28;
-  height_ = 36;
+  // Already compiled, so just point at it.
+  data_ = (const uint8_t *)&DEFAULT_LEVEL.image;
+  size_ = sizeof(DEFAULT_LEVEL.image);
+  isMapped_ = false;
+  isOwned_ = false;
+  header_ = &DEFAULT_LEVEL.image.header;
+  tiles_ = DEFAULT_LEVEL.image.tiles.data();
+  wallSprites_ = DEFAULT_LEVEL.image.wallSprites.data();
+  success_ = true;
+}
+
+Level::~Level()
+{
+  release();
+}
+
+void Level::release()
+{
+  if (data_ != NULL) {
+    if (isMapped_) {
+      munmap((void *)data_, size_);
+    } else if (isOwned_) {
+      free((void *)data_);
+    }
+  }
+  data_ = NULL;
+  size_ = 0;
+  isMapped_ = false;
+  isOwned_ = false;
+  header_ = NULL;
+  tiles_ = NULL;
+  wallSprites_ = NULL;
+}
+
+bool Level::getSuccess()
+{
+  return success_;
+}
+
+bool Level::compile(const char *text, int width, int height)
+{
+  bool success = true;
+  if (width <= 0 || height <= 0 || width > MAX_SIZE || height > MAX_SIZE) {
+    printf("Level must be from 1x1 to %dx%d tiles, not %dx%d!\n", MAX_SIZE, MAX_SIZE, width, height);
+    success = false;
+  }
+  
+  // The header, then the tiles, then the wall sprites.
+  int numTiles = width * height;
+  size_t size = sizeof(LevelHeader) + (2 * (size_t)numTiles);
+  uint8_t *data = NULL;
+  if (success) {
+    data = (uint8_t *)calloc(size, 1);
+    if (data == NULL) {
+      printf("Failed to allocate memory for level!\n");
+      success = false;
+    }
+  }
+  
+  LevelHeader *header = (LevelHeader *)data;
+  if (success) {
+    header->fileSize = (uint32_t)size;
+    header->tilesOffset = sizeof(LevelHeader);
+    header->wallSpritesOffset = sizeof(LevelHeader) + numTiles;
+    int errorX;
+    int errorY;
+    const char *error = parseLevel(text, width, height, header,
+                                   data + header->tilesOffset, data + header->wallSpritesOffset,
+                                   &errorX, &errorY);
+    if (error != NULL && errorX != -1) {
+      printf("%s '%c' at (%d, %d)\n", error, text[(errorY * width) + errorX], errorX, errorY);
+      success = false;
+    } else if (error != NULL) {
+      printf("%s\n", error);
+      success = false;
+    }
+  }
+  
+  if (!success) {
+    if (data != NULL) free(data);
+    success_ = false;
+    return false;
+  }
+  
+  release();
+  data_ = data;
+  size_ = size;
+  isOwned_ = true;
+  header_ = header;
+  tiles_ = data + header->tilesOffset;
+  wallSprites_ = data + header->wallSpritesOffset;
+  success_ = true;
+  return true;
+}
+
+bool Level::save(const char *path)
+{
+  if (data_ == NULL) {
+    printf("No level to save!\n");
+    return false;
+  }
+  FILE *file = fopen(path, "wb");
+  if (file == NULL) {
+    printf("Unable to open level '%s' for writing!\n", path);
+    return false;
+  }
+  
+  // Laid out in memory exactly as in the file.
+  fwrite(data_, 1, size_, file);
   
-  levelText_ = defaultLevelText;
+  bool success = !ferror(file);
+  if (fclose(file) != 0) success = false;
+  if (!success) printf("Failed to write level '%s'!\n", path);
+  return success;
 }
 
-Level::~Level() {}
+bool Level::load(const char *path)
+{
+  int file = open(path, O_RDONLY);
+  if (file == -1) {
+    printf("Unable to open level '%s'!\n", path);
+    success_ = false;
+    return false;
+  }
+  
+  bool success = true;
+  struct stat status;
+  size_t size = 0;
+  if (fstat(file, &status) != 0) {
+    printf("Unable to read level '%s'!\n", path);
+    success = false;
+  } else if ((size_t)status.st_size < sizeof(LevelHeader)) {
+    printf("'%s' is not a level!\n", path);
+    success = false;
+  } else {
+    size = (size_t)status.st_size;
+  }
+  
+  // Levels are never written to once compiled, so share the pages
+  // with every other process that has the same level loaded.
+  const uint8_t *data = NULL;
+  if (success) {
+    void *mapping = mmap(NULL, size, PROT_READ, MAP_SHARED, file, 0);
+    if (mapping == MAP_FAILED) {
+      printf("Unable to map level '%s'!\n", path);
+      success = false;
+    } else {
+      data = (const uint8_t *)mapping;
+    }
+  }
+  // The mapping stays valid once the file is closed.
+  close(file);
+  
+  if (success && !isValid((const LevelHeader *)data, size, path)) {
+    success = false;
+  }
+  if (!success) {
+    if (data != NULL) munmap((void *)data, size);
+    success_ = false;
+    return false;
+  }
+  
+  release();
+  data_ = data;
+  size_ = size;
+  isMapped_ = true;
+  isOwned_ = true;
+  header_ = (const LevelHeader *)data;
+  tiles_ = data + header_->tilesOffset;
+  wallSprites_ = data + header_->wallSpritesOffset;
+  success_ = true;
+  return true;
+}
 
-std::string Level::getLevelText()
+bool Level::isValid(const LevelHeader *header, size_t size, const char *path)
 {
-  return levelText_;
+  if (memcmp(header->magic, MAGIC, sizeof(MAGIC)) != 0) {
+    printf("'%s' is not a level!\n", path);
+    return false;
+  }
+  if (header->version != VERSION) {
+    printf("Level '%s' is version %u, expected version %u!\n", path, header->version, VERSION);
+    return false;
+  }
+  if (header->fileSize != size) {
+    printf("Level '%s' is truncated!\n", path);
+    return false;
+  }
+  
+  // Everything else is checked so far as to make sure reading the level
+  // never goes outside the file, and that the portals and where every
+  // actor starts agree with the tiles, as they would in a compiled level.
+  int width = header->width;
+  int height = header->height;
+  if (width <= 0 || height <= 0 || width > MAX_SIZE || height > MAX_SIZE) {
+    printf("Level '%s' is corrupt!\n", path);
+    return false;
+  }
+  size_t numTiles = (size_t)width * height;
+  if (header->tilesOffset < sizeof(LevelHeader) || header->tilesOffset > size ||
+      size - header->tilesOffset < numTiles ||
+      header->wallSpritesOffset < sizeof(LevelHeader) || header->wallSpritesOffset > size ||
+      size - header->wallSpritesOffset < numTiles) {
+    printf("Level '%s' is corrupt!\n", path);
+    return false;
+  }
+  const uint8_t *tiles = (const uint8_t *)header + header->tilesOffset;
+  const uint8_t *wallSprites = (const uint8_t *)header + header->wallSpritesOffset;
+  int numPortals = 0;
+  for (size_t i = 0; i < numTiles; i++) {
+    if (tiles[i] > TILE_GATE || wallSprites[i] > WALL_GATE) {
+      printf("Level '%s' is corrupt!\n", path);
+      return false;
+    }
+    if (tiles[i] == TILE_PORTAL) numPortals++;
+  }
+  auto isTile = [tiles, width, height](int x, int y, TileType tile) {
+    return x >= 0 && x < width && y >= 0 && y < height && tiles[(y * width) + x] == tile;
+  };
+
+  // PACMAN and Blinky start on empty tiles, the rest inside the base.
+  for (int i = 0; i < NUM_LEVEL_ACTORS; i++) {
+    const LevelActor *actor = &header->actors[i];
+    TileType startTile = (i == LEVEL_PACMAN || i == LEVEL_BLINKY) ? TILE_NONE : TILE_BASE;
+    if (!isTile(actor->startTileX, actor->startTileY, startTile) ||
+        actor->direction < DIRECTION_NONE || actor->direction > DIRECTION_RIGHT) {
+      printf("Level '%s' is corrupt!\n", path);
+      return false;
+    }
+  }
+
+  // Either no portals at all, or two different portal tiles, and no others.
+  bool hasPortals = (header->portalOneX != -1);
+  bool isPortalsValid;
+  if (hasPortals) {
+    isPortalsValid = numPortals == 2 &&
+                     isTile(header->portalOneX, header->portalOneY, TILE_PORTAL) &&
+                     isTile(header->portalTwoX, header->portalTwoY, TILE_PORTAL) &&
+                     (header->portalOneX != header->portalTwoX ||
+                      header->portalOneY != header->portalTwoY);
+  } else {
+    isPortalsValid = numPortals == 0 && header->portalOneY == -1 &&
+                     header->portalTwoX == -1 && header->portalTwoY == -1;
+  }
+  if (!isPortalsValid) {
+    printf("Level '%s' is corrupt!\n", path);
+    return false;
+  }
+  return true;
 }
 
 int Level::getWidth()
 {
-  return width_;
+  return header_->width;
 }
 
 int Level::getHeight()
 {
-  return height_;
+  return header_->height;
+}
+
+TileType Level::getTile(int tileX, int tileY)
+{
+  if (tileX < 0 || tileX >= header_->width || tileY < 0 || tileY >= header_->height) {
+    return TILE_WALL;
+  }
+  return (TileType)tiles_[(tileY * header_->width) + tileX];
+}
+
+WallSprite Level::getWallSprite(int tileX, int tileY)
+{
+  if (tileX < 0 || tileX >= header_->width || tileY < 0 || tileY >= header_->height) {
+    return WALL_NONE;
+  }
+  return (WallSprite)wallSprites_[(tileY * header_->width) + tileX];
+}
+
+int Level::getTotalPellets()
+{
+  return header_->totalPellets;
+}
+
+int Level::getPortalOneX()
+{
+  return header_->portalOneX;
+}
+
+int Level::getPortalOneY()
+{
+  return header_->portalOneY;
+}
+
+int Level::getPortalTwoX()
+{
+  return header_->portalTwoX;
+}
+
+int Level::getPortalTwoY()
+{
+  return header_->portalTwoY;
+}
+
+const LevelActor &Level::getActor(LevelActorIndex actor)
+{
+  return header_->actors[actor];
+}
+
+uint32_t Level::getHash()
+{
+  // FNV-1a. The default level is laid out exactly as a file, so hashes the
+  // same as the default level compiled by lvlc.
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < size_; i++) {
+    hash = (hash ^ data_[i]) * 16777619u;
+  }
+  return hash;
 }
@@ -1,33 +1,137 @@
-// FIXME: Currently is just a wrapper around a std::string.
-
 #ifndef level_h
 #define level_h
 
-#include <string>
-#include "actor.h"
+#include <stddef.h>
+#include <stdint.h>
+#include "tile.h"
+#include "wall.h"
+
+// The actors every level has, in the order they are stored in.
+typedef enum {
+  LEVEL_PACMAN,
+  LEVEL_BLINKY,
+  LEVEL_INKY,
+  LEVEL_PINKY,
+  LEVEL_CLYDE,
+  NUM_LEVEL_ACTORS
+} LevelActorIndex;
+
+// Where an actor starts, all in tile space. The spot in the base and
+// scatter corner are only used by ghosts, and are -1 for PACMAN.
+struct LevelActor {
+  int32_t startTileX;
+  int32_t startTileY;
+  int32_t direction;      // A Direction.
+  int32_t waitingPellets; // Pellets to wait in the base for.
+  int32_t spotTileX;      // Where to go inside the base once eaten.
+  int32_t spotTileY;
+  int32_t scatterTileX;   // Corner to head for in Scatter mode.
+  int32_t scatterTileY;
+};
+
+/**
+ * A compiled level: the tiles, the sprite each wall is drawn with, and
+ * everything else that used to be worked out from the level text every
+ * time a game started (pellet count, portals, where every actor starts).
+ *
+ * Compiled levels are saved in a binary file laid out exactly as held in
+ * memory, so loading one is a single mmap() with a few checks, and no
+ * parsing. Use lvlc to compile a text level into one.
+ *
+ * File format, all integers little-endian (loading fails on a
+ * big-endian machine, as the version comes out wrong):
+ *
+ *   LevelHeader        see below, fixed size
+ *   tiles              width x height TileType bytes, row by row,
+ *                      at tilesOffset
+ *   wall sprites       width x height WallSprite bytes, row by row,
+ *                      at wallSpritesOffset
+ */
+struct LevelHeader {
+  char magic[4];                         // "PMLV"
+  uint32_t version;                      // 1
+  uint32_t fileSize;                     // Bytes in the whole file.
+  int32_t width;                         // In tiles.
+  int32_t height;
+  int32_t totalPellets;                  // Not counting power pellets.
+  int32_t portalOneX;                    // Portal one is on the left edge,
+  int32_t portalOneY;                    // portal two on the right, and
+  int32_t portalTwoX;                    // both are -1 if there are none.
+  int32_t portalTwoY;
+  LevelActor actors[NUM_LEVEL_ACTORS];
+  uint32_t tilesOffset;
+  uint32_t wallSpritesOffset;
+};
 
 class Level {
   public:
     /**
      * Calling default constructor results in
-     * the default level being instantiated.
+     * the default level being instantiated. It is compiled along with the
+     * game, so this costs nothing, and never fails.
      */
     Level();
     ~Level();
-    
+
+    // Return whether the last compile(), load() or the constructor succeeded.
+    bool getSuccess();
+
     /**
-     * Returns the level text provided to us on instantiation,
-     * which would be the default level's text if the default
-     * no-args constructor was called.
+     * Replace this level with one compiled from text, width x height
+     * characters row by row:
+     *
+     *   '-' empty          '#' wall           'g' gate of the base
+     *   'x' pellet         'y' power pellet   '+' inside of the base
+     *   't' portal         '0' PACMAN         'b' Blinky, outside the base
+     *   'i', 'p', 'c'      Inky, Pinky and Clyde, inside the base
+     *
+     * \Returns false, printing why, if the text isn't a valid level.
      */
-    std::string getLevelText();
+    bool compile(const char *text, int width, int height);
+
+    // \Returns false on failure to write or read the file.
+    bool save(const char *path);
+    bool load(const char *path);
+
     int getWidth();
     int getHeight();
-    
+
+    // Tiles off the board are walls, as with Board.
+    TileType getTile(int tileX, int tileY);
+    WallSprite getWallSprite(int tileX, int tileY);
+
+    int getTotalPellets();
+    int getPortalOneX();
+    int getPortalOneY();
+    int getPortalTwoX();
+    int getPortalTwoY();
+    const LevelActor &getActor(LevelActorIndex actor);
+
+    // A hash of the whole compiled level, the same however it was loaded,
+    // for telling which level a recording was made on.
+    uint32_t getHash();
+
+    static const uint32_t VERSION = 1;
+
   private:
-    std::string levelText_;
-    int width_;
-    int height_;
+    // Forget the current level, unmapping or freeing it.
+    void release();
+
+    // Check a header read from size bytes of file, printing why not.
+    bool isValid(const LevelHeader *header, size_t size, const char *path);
+
+    // The whole level, laid out as in the file.
+    const uint8_t *data_;
+    size_t size_;
+    bool isOwned_;         // data_ is to be freed, rather than built in.
+    bool isMapped_;        // data_ is mmap()ed, rather than malloc()ed.
+
+    // Into data_.
+    const LevelHeader *header_;
+    const uint8_t *tiles_;
+    const uint8_t *wallSprites_;
+
+    bool success_;
 };
 
 #endif /* level_h */
@@ -0,0 +1,110 @@
+// lvlc: compiles a text level into the binary level format (see level.h),
+// which the game and pacman-sim load with --level.
+//
+// Build with:
+//   cmake --build build --target lvlc
+//
+// For example:
+//   ./build/lvlc levels/default.lvl default.lvb
+//
+// A text level is one line per row of tiles, every row the same width,
+// using the characters listed at Level::compile(). Blank lines are skipped.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "level.h"
+
+/**
+ * Read the rows of a text level into one string, row by row.
+ * \Returns the text, to be freed by the caller, or NULL on failure.
+ */
+static char *readLevelText(const char *path, int *width, int *height)
+{
+  FILE *file = fopen(path, "r");
+  if (file == NULL) {
+    printf("Unable to open '%s'!\n", path);
+    return NULL;
+  }
+
+  bool success = true;
+  char *text = NULL;
+  int length = 0;
+  int capacity = 0;
+  *width = 0;
+  *height = 0;
+  char line[1024];
+  while (success && fgets(line, sizeof(line), file) != NULL) {
+    int lineLength = (int)strcspn(line, "\r\n");
+    if (lineLength == (int)sizeof(line) - 1) {
+      printf("Row %d of '%s' is too long!\n", *height + 1, path);
+      success = false;
+      break;
+    }
+    if (lineLength == 0) continue;
+    if (*height == 0) {
+      *width = lineLength;
+    } else if (lineLength != *width) {
+      printf("Row %d of '%s' is %d tiles wide, expected %d!\n",
+             *height + 1, path, lineLength, *width);
+      success = false;
+      break;
+    }
+    if (length + lineLength > capacity) {
+      int newCapacity = (capacity == 0) ? 4096 : capacity * 2;
+      while (newCapacity < length + lineLength) newCapacity *= 2;
+      char *newText = (char *)realloc(text, newCapacity);
+      if (newText == NULL) {
+        printf("Failed to allocate memory for level text!\n");
+        success = false;
+        break;
+      }
+      text = newText;
+      capacity = newCapacity;
+    }
+    memcpy(text + length, line, lineLength);
+    length += lineLength;
+    (*height)++;
+  }
+  if (success && ferror(file)) {
+    printf("Failed to read '%s'!\n", path);
+    success = false;
+  }
+  if (success && *height == 0) {
+    printf("'%s' has no rows!\n", path);
+    success = false;
+  }
+  fclose(file);
+
+  if (!success) {
+    if (text != NULL) free(text);
+    return NULL;
+  }
+  return text;
+}
+
+int main(int argc, char *argv[])
+{
+  if (argc != 3) {
+    printf("Usage: %s level.lvl level.lvb\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  int width;
+  int height;
+  char *text = readLevelText(argv[1], &width, &height);
+  if (text == NULL) {
+    return EXIT_FAILURE;
+  }
+
+  Level *level = new Level();
+  bool success = level->compile(text, width, height) && level->save(argv[2]);
+  free(text);
+
+  if (success) {
+    printf("Compiled '%s': %dx%d tiles, %d pellets, %s.\n", argv[1], width, height,
+           level->getTotalPellets(), (level->getPortalOneX() != -1) ? "two portals" : "no portals");
+  }
+  delete level;
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
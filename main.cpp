@@ -1,14 +1,227 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <chrono>
 
 #include "game.h"
+#include "level.h"
+#include "rasterizer.h"
+#include "recording.h"
+#include "simulation.h"
+
+/**
+ * Draw the simulation, playing on level, as it is now into a PPM image,
+ * with no window, e.g. for a thumbnail of how a replayed game ended.
+ */
+static bool saveScreenshot(Simulation *simulation, Level *level, const char *path)
+{
+  bool success = true;
+  Rasterizer rasterizer;
+  if (!rasterizer.init(level, simulation->getNumGhosts())) {
+    success = false;
+  }
+  
+  Snapshot snapshot;
+  snapshot.ghosts = (ActorSnapshot *)malloc(simulation->getNumGhosts() * sizeof(ActorSnapshot));
+  snapshot.tiles = (uint8_t *)malloc(simulation->getBoardWidth() * simulation->getBoardHeight());
+  snapshot.boardVersion = -1;
+  if (snapshot.ghosts == NULL || snapshot.tiles == NULL) {
+    printf("Failed to allocate memory for snapshot!\n");
+    success = false;
+  }
+  
+  if (success) {
+    takeSnapshot(simulation, &snapshot);
+    rasterizer.render(&snapshot);
+    success = rasterizer.savePpm(path);
+  }
+  if (snapshot.ghosts != NULL) free(snapshot.ghosts);
+  if (snapshot.tiles != NULL) free(snapshot.tiles);
+  return success;
+}
+
+/**
+ * Play a recorded session through the simulation, with no window and as
+ * fast as the CPU allows, then print how long that took and where the
+ * game ended up, so that two replays can be compared. Recordings keep
+ * how many ghosts there were, but only a hash of the level, so the level
+ * has to be given again, levelPath being NULL for the default level, and
+ * is refused if it isn't the one recorded on. So is numGhosts, unless
+ * -1 for as recorded, if it isn't as recorded. If screenshotPath is not NULL, the last tick is
+ * also drawn into it.
+ */
+static bool replay(const char *path, const char *levelPath, int numGhosts,
+                   const char *screenshotPath)
+{
+  Recording recording;
+  if (!recording.load(path)) {
+    return false;
+  }
+  if (numGhosts != -1 && numGhosts != recording.getNumGhosts()) {
+    printf("Recording '%s' was played against %d ghosts, not %d!\n", path,
+           recording.getNumGhosts(), numGhosts);
+    return false;
+  }
+  Level level;
+  if (levelPath != NULL && !level.load(levelPath)) {
+    return false;
+  }
+  if (level.getHash() != recording.getLevelHash()) {
+    printf("Recording '%s' was played on a different level than %s!\n", path,
+           (levelPath != NULL) ? levelPath : "the default level");
+    return false;
+  }
+  Simulation *simulation = new Simulation(recording.getTicksPerSecond(), recording.getSeed(),
+                                          &level, recording.getNumGhosts());
+  if (!simulation->getSuccess()) {
+    printf("Simulation initialisation failed!\n");
+    delete simulation;
+    return false;
+  }
+  
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  while (!recording.isFinished()) {
+    simulation->update(recording.nextDirection());
+  }
+  double elapsedMs = std::chrono::duration<double, std::milli>(
+    std::chrono::steady_clock::now() - start).count();
+  
+  printf("Replayed %d ticks in %.3f ms (%.0f ticks per second).\n", recording.getNumTicks(),
+         elapsedMs, (elapsedMs > 0) ? recording.getNumTicks() / (elapsedMs / 1000) : 0.0);
+  const char *result = "not over";
+  if (simulation->isGameOver()) result = simulation->isGameOverWin() ? "won" : "lost";
+  printf("Game %s, %d of %d pellets eaten.\n", result,
+         simulation->getPellets(), simulation->getTotalPellets());
+  const char *names[Simulation::NUM_PERSONALITIES] = { "Blinky", "Inky", "Pinky", "Clyde" };
+  Actor *pacman = simulation->getPacman();
+  printf("  %-7s at (%d, %d), state %d\n", "PACMAN",
+         pacman->getX(), pacman->getY(), pacman->getState());
+  for (int i = 0; i < simulation->getNumGhosts(); i++) {
+    Actor *ghost = simulation->getGhost(i);
+    printf("  %-7s at (%d, %d), state %d", names[i % Simulation::NUM_PERSONALITIES],
+           ghost->getX(), ghost->getY(), ghost->getState());
+    if (i >= Simulation::NUM_PERSONALITIES) printf(" (ghost %d)", i);
+    printf("\n");
+  }
+  
+  bool success = true;
+  if (screenshotPath != NULL && !saveScreenshot(simulation, &level, screenshotPath)) {
+    success = false;
+  }
+  
+  delete simulation;
+  return success;
+}
+
+/**
+ * Read "address:port" into options.
+ * \Returns false if it isn't in that form.
+ */
+static bool parsePeer(char *peer, NetplayOptions *options)
+{
+  char *colon = strrchr(peer, ':');
+  if (colon == NULL || colon == peer || atoi(colon + 1) <= 0) {
+    return false;
+  }
+  *colon = '\0';
+  options->remoteHost = peer;
+  options->remotePort = atoi(colon + 1);
+  return true;
+}
+
+static void printUsage(const char *program)
+{
+  printf("Usage: %s [--sim-rate 60|120|240] [--display-rate hz] [--software] [--dirty-rects]\n"
+         "          [--low-latency] [--seed n] [--record file] [--level file.lvb] [--ghosts n]\n"
+         "          [--capture file.y4m|'|command'] [--capture-drop]\n"
+         "          [--netplay pacman|ghost --port n --peer address:port]\n"
+         "          [--net-latency ms] [--net-jitter ms] [--net-loss percent]\n"
+         "       %s --replay file [--level file.lvb] [--ghosts n] [--screenshot file.ppm]\n",
+         program, program);
+}
 
 int main(int argc, char *argv[])
 {
   bool success = true;
   
+  // Read command line options.
+  GameOptions options;
+  const char *replayPath = NULL;
+  const char *screenshotPath = NULL;
+  bool isNumGhostsGiven = false;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--sim-rate") == 0 && i + 1 < argc) {
+      options.simulationRate = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--display-rate") == 0 && i + 1 < argc) {
+      options.displayRate = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--software") == 0) {
+      options.useSoftwareRenderer = true;
+    } else if (strcmp(argv[i], "--dirty-rects") == 0) {
+      options.useDirtyRects = true;
+    } else if (strcmp(argv[i], "--low-latency") == 0) {
+      options.lowLatencyInput = true;
+    } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+      options.seed = (uint32_t)strtoul(argv[++i], NULL, 10);
+    } else if (strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+      options.recordPath = argv[++i];
+    } else if (strcmp(argv[i], "--level") == 0 && i + 1 < argc) {
+      options.levelPath = argv[++i];
+    } else if (strcmp(argv[i], "--capture") == 0 && i + 1 < argc) {
+      options.capturePath = argv[++i];
+    } else if (strcmp(argv[i], "--capture-drop") == 0) {
+      options.captureOverflow = CAPTURE_DROP;
+    } else if (strcmp(argv[i], "--ghosts") == 0 && i + 1 < argc) {
+      options.numGhosts = atoi(argv[++i]);
+      isNumGhostsGiven = true;
+    } else if (strcmp(argv[i], "--netplay") == 0 && i + 1 < argc &&
+               (strcmp(argv[i + 1], "pacman") == 0 || strcmp(argv[i + 1], "ghost") == 0)) {
+      options.isNetplay = true;
+      options.netplay.role = (strcmp(argv[++i], "pacman") == 0) ? NETPLAY_PACMAN : NETPLAY_GHOST;
+    } else if (strcmp(argv[i], "--port") == 0 && i + 1 < argc) {
+      options.netplay.localPort = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--peer") == 0 && i + 1 < argc && parsePeer(argv[i + 1], &options.netplay)) {
+      i++;
+    } else if (strcmp(argv[i], "--net-latency") == 0 && i + 1 < argc) {
+      options.netplay.latencyMs = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--net-jitter") == 0 && i + 1 < argc) {
+      options.netplay.jitterMs = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--net-loss") == 0 && i + 1 < argc) {
+      options.netplay.lossPercent = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+      replayPath = argv[++i];
+    } else if (strcmp(argv[i], "--screenshot") == 0 && i + 1 < argc) {
+      screenshotPath = argv[++i];
+    } else {
+      printUsage(argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+  
+  // Only a replayed game is drawn into a screenshot.
+  if (screenshotPath != NULL && replayPath == NULL) {
+    printUsage(argv[0]);
+    return EXIT_FAILURE;
+  }
+  
+  // Recordings only have PACMAN's directions in them.
+  if (options.isNetplay && options.recordPath != NULL) {
+    printf("Netplay games can't be recorded!\n");
+    return EXIT_FAILURE;
+  }
+  if (options.isNetplay && (options.netplay.localPort <= 0 || options.netplay.remotePort <= 0)) {
+    printf("Netplay needs --port and --peer!\n");
+    return EXIT_FAILURE;
+  }
+  
+  // Replaying needs no window.
+  if (replayPath != NULL) {
+    return replay(replayPath, options.levelPath, isNumGhostsGiven ? options.numGhosts : -1,
+                  screenshotPath) ?
+           EXIT_SUCCESS : EXIT_FAILURE;
+  }
+  
   // Initialise game.
-  Game *game = new Game();
+  Game *game = new Game(options);
   if (game->getSuccess() == false) {
     printf("Game initialisation failed!\n");
     success = false;
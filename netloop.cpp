@@ -0,0 +1,187 @@
+// netloop: plays a netplay game between two peers in one process, over
+// UDP on 127.0.0.1, each steered by a script, with latency, jitter and
+// packet loss injected into every packet. Once both have stepped every
+// tick and heard every input, checks that both games, and the same game
+// replayed offline with the real inputs, ended in exactly the same state.
+//
+// Build with:
+//   cmake --build build --target netloop
+//
+// For example, 20 seconds over a bad connection, the ghost's peer joining
+// half a second late:
+//   ./build/netloop --ticks 1200 --latency 60 --jitter 30 --loss 10 --late 500
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <thread>
+#include "netplay.h"
+#include "simulation.h"
+
+static const char *ROLE_NAMES[2] = { "PACMAN", "ghost" };
+
+// How many ticks each scripted player holds a direction for.
+static const int HOLD_TICKS = 15;
+
+/**
+ * Direction the script for role holds on the given tick: a new one at
+ * random every HOLD_TICKS ticks. PACMAN always holds one, the ghost's
+ * player sometimes lets go, leaving the ghost to chase on its own.
+ */
+static Direction getScriptedInput(NetplayRole role, int tick)
+{
+  Random random((uint32_t)((tick / HOLD_TICKS) * 2 + role));
+  int choice = random.nextInt(5);
+  if (role == NETPLAY_PACMAN && choice == DIRECTION_NONE) return DIRECTION_RIGHT;
+  return (Direction)choice;
+}
+
+// One side of the game.
+struct Peer {
+  Simulation *simulation;
+  NetplaySession session;
+  std::chrono::steady_clock::time_point nextTick;
+};
+
+static int64_t getMs(std::chrono::steady_clock::duration duration)
+{
+  return std::chrono::duration_cast<std::chrono::milliseconds>(duration).count();
+}
+
+static void printPeer(NetplayRole role, Peer *peer)
+{
+  NetplaySession &session = peer->session;
+  printf("%-7s %d ticks, %d rollbacks (%d ticks replayed, longest %d), %d stalls, "
+         "%d packets sent (%d dropped)\n", ROLE_NAMES[role], session.getNumTicks(),
+         session.getNumRollbacks(), session.getNumTicksReplayed(),
+         session.getLongestRollback(), session.getNumStalls(),
+         session.getLink()->getNumPacketsSent(), session.getLink()->getNumPacketsDropped());
+}
+
+int main(int argc, char *argv[])
+{
+  // Read command line options.
+  int numTicks = 600;
+  int ticksPerSecond = Simulation::DEFAULT_TICKS_PER_SECOND;
+  uint32_t seed = 1;
+  int numGhosts = Simulation::DEFAULT_NUM_GHOSTS;
+  int port = 7700;
+  int lateMs = 0;
+  NetplayOptions options;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--ticks") == 0 && i + 1 < argc) {
+      numTicks = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--sim-rate") == 0 && i + 1 < argc) {
+      ticksPerSecond = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+      seed = (uint32_t)strtoul(argv[++i], NULL, 10);
+    } else if (strcmp(argv[i], "--ghosts") == 0 && i + 1 < argc) {
+      numGhosts = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--port") == 0 && i + 1 < argc) {
+      port = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--latency") == 0 && i + 1 < argc) {
+      options.latencyMs = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--jitter") == 0 && i + 1 < argc) {
+      options.jitterMs = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--loss") == 0 && i + 1 < argc) {
+      options.lossPercent = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--late") == 0 && i + 1 < argc) {
+      lateMs = atoi(argv[++i]);
+    } else {
+      printf("Usage: %s [--ticks n] [--sim-rate n] [--seed n] [--ghosts n] [--port n]\n"
+             "          [--latency ms] [--jitter ms] [--loss percent] [--late ms]\n", argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+
+  // PACMAN's peer listens on port, the ghost's on the next one up.
+  Peer peers[2];
+  bool success = true;
+  for (int role = NETPLAY_PACMAN; role <= NETPLAY_GHOST; role++) {
+    peers[role].simulation = new Simulation(ticksPerSecond, seed, NULL, numGhosts);
+    options.role = (NetplayRole)role;
+    options.localPort = port + role;
+    options.remotePort = port + 1 - role;
+    if (!peers[role].simulation->getSuccess() ||
+        !peers[role].session.start(peers[role].simulation, options)) {
+      success = false;
+    }
+  }
+  if (!success) {
+    printf("Failed to start netplay!\n");
+    return EXIT_FAILURE;
+  }
+  printf("%d ticks at %d per second, %d ms latency, %d ms jitter, %d%% loss, ghost %d ms late.\n",
+         numTicks, ticksPerSecond, options.latencyMs, options.jitterMs, options.lossPercent, lateMs);
+
+  // Each peer steps a tick whenever one is due, as Game does, and takes
+  // in packets in between. Once done, they carry on taking in packets
+  // until both have heard every input.
+  std::chrono::steady_clock::duration tickLength =
+    std::chrono::nanoseconds(1000000000 / ticksPerSecond);
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  peers[NETPLAY_PACMAN].nextTick = start;
+  peers[NETPLAY_GHOST].nextTick = start + std::chrono::milliseconds(lateMs);
+  std::chrono::steady_clock::time_point deadline =
+    start + std::chrono::milliseconds(lateMs + 10000) + (numTicks * 2 * tickLength);
+  while (true) {
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    bool isFinished = true;
+    for (int role = NETPLAY_PACMAN; role <= NETPLAY_GHOST; role++) {
+      Peer &peer = peers[role];
+      if (peer.session.getNumTicks() < numTicks && now >= peer.nextTick) {
+        peer.session.advance(getScriptedInput((NetplayRole)role, peer.session.getNumTicks()));
+        peer.nextTick += tickLength;
+      } else {
+        peer.session.poll();
+      }
+      if (peer.session.getNumConfirmedTicks() < numTicks) isFinished = false;
+    }
+    if (isFinished) break;
+    if (now > deadline) {
+      printf("Timed out after %lld ms!\n", (long long)getMs(now - start));
+      printPeer(NETPLAY_PACMAN, &peers[NETPLAY_PACMAN]);
+      printPeer(NETPLAY_GHOST, &peers[NETPLAY_GHOST]);
+      return EXIT_FAILURE;
+    }
+    std::this_thread::sleep_for(std::chrono::microseconds(500));
+  }
+  printPeer(NETPLAY_PACMAN, &peers[NETPLAY_PACMAN]);
+  printPeer(NETPLAY_GHOST, &peers[NETPLAY_GHOST]);
+
+  // The game as it should have gone, knowing every input all along.
+  Simulation reference(ticksPerSecond, seed, NULL, numGhosts);
+  reference.setControlledGhost(0);
+  for (int tick = 0; tick < numTicks; tick++) {
+    reference.update(getScriptedInput(NETPLAY_PACMAN, tick), getScriptedInput(NETPLAY_GHOST, tick));
+  }
+
+  SimulationState *state = (SimulationState *)malloc(sizeof(SimulationState));
+  if (state == NULL) {
+    printf("Failed to allocate memory for state!\n");
+    return EXIT_FAILURE;
+  }
+  uint32_t checksums[3];
+  peers[NETPLAY_PACMAN].simulation->saveState(state);
+  checksums[0] = getStateChecksum(state);
+  peers[NETPLAY_GHOST].simulation->saveState(state);
+  checksums[1] = getStateChecksum(state);
+  reference.saveState(state);
+  checksums[2] = getStateChecksum(state);
+  free(state);
+
+  const char *result = "not over";
+  if (reference.isGameOver()) result = reference.isGameOverWin() ? "won" : "lost";
+  bool isSame = checksums[0] == checksums[1] && checksums[1] == checksums[2] &&
+                !peers[NETPLAY_PACMAN].session.isDesynced() &&
+                !peers[NETPLAY_GHOST].session.isDesynced();
+  printf("Game %s, %d pellets eaten. States: PACMAN's %08x, ghost's %08x, offline %08x: %s\n",
+         result, reference.getPellets(), checksums[0], checksums[1], checksums[2],
+         isSame ? "same" : "DIFFERENT");
+
+  for (int role = NETPLAY_PACMAN; role <= NETPLAY_GHOST; role++) {
+    delete peers[role].simulation;
+  }
+  return isSame ? EXIT_SUCCESS : EXIT_FAILURE;
+}
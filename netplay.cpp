@@ -0,0 +1,481 @@
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <chrono>
+#include "netplay.h"
+
+// Bytes before the inputs in a packet, see NetplaySession.
+static const int HEADER_SIZE = 28;
+static const uint32_t NO_CHECKSUM = 0xFFFFFFFF;
+
+static int64_t getMicroseconds()
+{
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static void put32(uint8_t *bytes, uint32_t value)
+{
+  bytes[0] = (uint8_t)value;
+  bytes[1] = (uint8_t)(value >> 8);
+  bytes[2] = (uint8_t)(value >> 16);
+  bytes[3] = (uint8_t)(value >> 24);
+}
+
+static uint32_t get32(const uint8_t *bytes)
+{
+  return bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) | ((uint32_t)bytes[3] << 24);
+}
+
+// FNV-1a, carrying on from hash.
+static uint32_t hashBytes(uint32_t hash, const void *data, size_t size)
+{
+  const uint8_t *bytes = (const uint8_t *)data;
+  for (size_t i = 0; i < size; i++) {
+    hash = (hash ^ bytes[i]) * 16777619u;
+  }
+  return hash;
+}
+
+uint32_t getStateChecksum(const SimulationState *state)
+{
+  // Only what is in use, which also leaves out any padding: everything
+  // up to the last ghost, then everything from the counters to the last tile.
+  size_t ghostsEnd = offsetof(SimulationState, ghosts) + (state->numGhosts * sizeof(Actor));
+  size_t countersStart = offsetof(SimulationState, currentModeIndex);
+  size_t tilesEnd = offsetof(SimulationState, tiles) + state->numTileBytes;
+  uint32_t hash = hashBytes(2166136261u, state, ghostsEnd);
+  return hashBytes(hash, (const uint8_t *)state + countersStart, tilesEnd - countersStart);
+}
+
+UdpLink::UdpLink()
+{
+  socket_ = -1;
+  remoteAddress_ = 0;
+  remotePort_ = 0;
+  latencyUs_ = 0;
+  jitterUs_ = 0;
+  lossPercent_ = 0;
+  numHeld_ = 0;
+  numPacketsSent_ = 0;
+  numPacketsDropped_ = 0;
+}
+
+UdpLink::~UdpLink()
+{
+  if (socket_ != -1) close(socket_);
+}
+
+bool UdpLink::open(const NetplayOptions &options)
+{
+  struct in_addr remote;
+  if (inet_pton(AF_INET, options.remoteHost, &remote) != 1) {
+    printf("'%s' is not an IPv4 address!\n", options.remoteHost);
+    return false;
+  }
+  remoteAddress_ = remote.s_addr;
+  remotePort_ = htons((uint16_t)options.remotePort);
+  latencyUs_ = options.latencyMs * 1000;
+  jitterUs_ = options.jitterMs * 1000;
+  lossPercent_ = options.lossPercent;
+  random_.setSeed((uint32_t)options.localPort);
+
+  socket_ = socket(AF_INET, SOCK_DGRAM, 0);
+  if (socket_ == -1) {
+    printf("Unable to create socket: %s\n", strerror(errno));
+    return false;
+  }
+  struct sockaddr_in local;
+  memset(&local, 0, sizeof(local));
+  local.sin_family = AF_INET;
+  local.sin_addr.s_addr = htonl(INADDR_ANY);
+  local.sin_port = htons((uint16_t)options.localPort);
+  if (bind(socket_, (struct sockaddr *)&local, sizeof(local)) == -1 ||
+      fcntl(socket_, F_SETFL, fcntl(socket_, F_GETFL, 0) | O_NONBLOCK) == -1) {
+    printf("Unable to listen on port %d: %s\n", options.localPort, strerror(errno));
+    close(socket_);
+    socket_ = -1;
+    return false;
+  }
+  return true;
+}
+
+bool UdpLink::isOpen()
+{
+  return socket_ != -1;
+}
+
+void UdpLink::send(const uint8_t *data, int size)
+{
+  if (lossPercent_ > 0 && random_.nextInt(100) < lossPercent_) {
+    numPacketsDropped_++;
+    return;
+  }
+  if (latencyUs_ == 0 && jitterUs_ == 0) {
+    struct sockaddr_in remote;
+    memset(&remote, 0, sizeof(remote));
+    remote.sin_family = AF_INET;
+    remote.sin_addr.s_addr = remoteAddress_;
+    remote.sin_port = remotePort_;
+    sendto(socket_, data, size, 0, (struct sockaddr *)&remote, sizeof(remote));
+    numPacketsSent_++;
+    return;
+  }
+
+  // Held back until due, in no particular order, as jitter can let a
+  // later packet overtake an earlier one.
+  if (numHeld_ == MAX_HELD_PACKETS || size > MAX_PACKET_SIZE) {
+    numPacketsDropped_++;
+    return;
+  }
+  HeldPacket &packet = held_[numHeld_++];
+  packet.dueTime = getMicroseconds() + latencyUs_;
+  if (jitterUs_ > 0) packet.dueTime += random_.nextInt(jitterUs_ + 1);
+  packet.size = size;
+  memcpy(packet.data, data, size);
+}
+
+void UdpLink::flush(int64_t now)
+{
+  struct sockaddr_in remote;
+  memset(&remote, 0, sizeof(remote));
+  remote.sin_family = AF_INET;
+  remote.sin_addr.s_addr = remoteAddress_;
+  remote.sin_port = remotePort_;
+  int i = 0;
+  while (i < numHeld_) {
+    if (held_[i].dueTime > now) {
+      i++;
+      continue;
+    }
+    sendto(socket_, held_[i].data, held_[i].size, 0, (struct sockaddr *)&remote, sizeof(remote));
+    numPacketsSent_++;
+    held_[i] = held_[--numHeld_];
+  }
+}
+
+int UdpLink::receive(uint8_t *data, int maxSize)
+{
+  if (numHeld_ > 0) {
+    flush(getMicroseconds());
+  }
+  while (true) {
+    struct sockaddr_in from;
+    socklen_t fromSize = sizeof(from);
+    ssize_t size = recvfrom(socket_, data, maxSize, 0, (struct sockaddr *)&from, &fromSize);
+    if (size <= 0) {
+      return 0;
+    }
+    // Anyone can send to our port, but only the peer is listened to.
+    if (from.sin_addr.s_addr == remoteAddress_ && from.sin_port == remotePort_) {
+      return (int)size;
+    }
+  }
+}
+
+int UdpLink::getNumPacketsSent()
+{
+  return numPacketsSent_;
+}
+
+int UdpLink::getNumPacketsDropped()
+{
+  return numPacketsDropped_;
+}
+
+NetplaySession::NetplaySession()
+{
+  simulation_ = NULL;
+  role_ = NETPLAY_PACMAN;
+  gameId_ = 0;
+  numTicks_ = 0;
+  numRemoteInputs_ = 0;
+  numInputsAcked_ = 0;
+  peerNumTicks_ = 0;
+  peerAdvantage_ = 0;
+  lastSendTime_ = 0;
+  states_ = NULL;
+  numFinalTicks_ = 0;
+  peerChecksumTick_ = -1;
+  peerChecksum_ = 0;
+  isDesynced_ = false;
+  numRollbacks_ = 0;
+  numTicksReplayed_ = 0;
+  longestRollback_ = 0;
+  numStalls_ = 0;
+  for (int i = 0; i < RING_SIZE; i++) {
+    localInputs_[i] = DIRECTION_NONE;
+    remoteInputs_[i] = DIRECTION_NONE;
+    usedRemoteInputs_[i] = DIRECTION_NONE;
+    checksumTicks_[i] = -1;
+  }
+}
+
+NetplaySession::~NetplaySession()
+{
+  if (states_ != NULL) free(states_);
+}
+
+bool NetplaySession::start(Simulation *simulation, const NetplayOptions &options)
+{
+  states_ = (SimulationState *)malloc(RING_SIZE * sizeof(SimulationState));
+  if (states_ == NULL) {
+    printf("Failed to allocate memory for netplay states!\n");
+    return false;
+  }
+  // The same game on both sides starts in the same state, at the same
+  // rate, from the same seed.
+  if (!simulation->saveState(&states_[0])) {
+    printf("Game is too big for netplay!\n");
+    return false;
+  }
+  gameId_ = getStateChecksum(&states_[0]);
+  int ticksPerSecond = simulation->getTicksPerSecond();
+  uint32_t seed = simulation->getSeed();
+  gameId_ = hashBytes(gameId_, &ticksPerSecond, sizeof(ticksPerSecond));
+  gameId_ = hashBytes(gameId_, &seed, sizeof(seed));
+
+  if (!link_.open(options)) {
+    return false;
+  }
+  simulation_ = simulation;
+  role_ = options.role;
+  simulation_->setControlledGhost(0);
+  return true;
+}
+
+bool NetplaySession::isStarted()
+{
+  return simulation_ != NULL;
+}
+
+bool NetplaySession::advance(Direction direction)
+{
+  int rollbackTick = receivePackets();
+  if (rollbackTick < numTicks_) {
+    rollBack(rollbackTick);
+  }
+
+  // Hold back if too far ahead to guess any further, or if further ahead
+  // of the peer than it is of us, by more than the odd tick either way.
+  bool isStepped = false;
+  int advantage = getAdvantage();
+  if (advantage < MAX_ROLLBACK_TICKS && advantage - peerAdvantage_ <= 2) {
+    localInputs_[numTicks_ % RING_SIZE] = (uint8_t)direction;
+    step();
+    isStepped = true;
+  } else {
+    numStalls_++;
+  }
+  checksumFinalStates();
+  sendInputs();
+  return isStepped;
+}
+
+void NetplaySession::poll()
+{
+  int rollbackTick = receivePackets();
+  if (rollbackTick < numTicks_) {
+    rollBack(rollbackTick);
+  }
+  checksumFinalStates();
+  if (getMicroseconds() - lastSendTime_ >= RESEND_INTERVAL_US) {
+    sendInputs();
+  }
+}
+
+int NetplaySession::receivePackets()
+{
+  int rollbackTick = numTicks_;
+  uint8_t packet[UdpLink::MAX_PACKET_SIZE];
+  int size;
+  while ((size = link_.receive(packet, sizeof(packet))) > 0) {
+    if (size < HEADER_SIZE || packet[0] != 'P' || packet[1] != 'N' ||
+        packet[2] == role_ || HEADER_SIZE + packet[3] > size) {
+      continue;
+    }
+    if (get32(packet + 4) != gameId_) {
+      // Not fatal, but nothing will happen until both play the same game.
+      if (!isDesynced_) printf("Netplay peer is playing a different game!\n");
+      isDesynced_ = true;
+      continue;
+    }
+
+    // Only what follows on from what we already have, so that the peer's
+    // inputs are always known for every tick up to numRemoteInputs_.
+    int firstTick = (int)get32(packet + 8);
+    for (int i = 0; i < packet[3]; i++) {
+      int tick = firstTick + i;
+      uint8_t input = packet[HEADER_SIZE + i];
+      if (tick != numRemoteInputs_ || input > DIRECTION_RIGHT) continue;
+      int slot = tick % RING_SIZE;
+      remoteInputs_[slot] = input;
+      numRemoteInputs_++;
+      if (tick < numTicks_ && input != usedRemoteInputs_[slot] && tick < rollbackTick) {
+        rollbackTick = tick;
+      }
+    }
+
+    int acked = (int)get32(packet + 12);
+    if (acked > numInputsAcked_ && acked <= numTicks_) {
+      numInputsAcked_ = acked;
+    }
+    int peerNumTicks = (int)get32(packet + 16);
+    if (peerNumTicks > peerNumTicks_) {
+      peerNumTicks_ = peerNumTicks;
+      peerAdvantage_ = peerNumTicks - acked;
+    }
+    uint32_t checksumTick = get32(packet + 20);
+    if (checksumTick != NO_CHECKSUM && (int)checksumTick > peerChecksumTick_) {
+      peerChecksumTick_ = (int)checksumTick;
+      peerChecksum_ = get32(packet + 24);
+    }
+  }
+  return rollbackTick;
+}
+
+void NetplaySession::rollBack(int tick)
+{
+  int numTicks = numTicks_;
+  simulation_->restoreState(&states_[tick % RING_SIZE]);
+  numTicks_ = tick;
+  while (numTicks_ < numTicks) {
+    step();
+  }
+  numRollbacks_++;
+  numTicksReplayed_ += numTicks - tick;
+  if (numTicks - tick > longestRollback_) longestRollback_ = numTicks - tick;
+}
+
+void NetplaySession::step()
+{
+  int slot = numTicks_ % RING_SIZE;
+  simulation_->saveState(&states_[slot]);
+
+  // Guess that the peer is still doing what it last did.
+  uint8_t remote = DIRECTION_NONE;
+  if (numTicks_ < numRemoteInputs_) {
+    remote = remoteInputs_[slot];
+  } else if (numRemoteInputs_ > 0) {
+    remote = remoteInputs_[(numRemoteInputs_ - 1) % RING_SIZE];
+  }
+  usedRemoteInputs_[slot] = remote;
+
+  Direction local = (Direction)localInputs_[slot];
+  if (role_ == NETPLAY_PACMAN) {
+    simulation_->update(local, (Direction)remote);
+  } else {
+    simulation_->update((Direction)remote, local);
+  }
+  numTicks_++;
+}
+
+void NetplaySession::checksumFinalStates()
+{
+  // The state before a tick is final once every input before it is known.
+  // Only those before ticks stepped have been saved.
+  int lastFinalTick = (numRemoteInputs_ < numTicks_ - 1) ? numRemoteInputs_ : numTicks_ - 1;
+  for (int tick = numFinalTicks_; tick <= lastFinalTick; tick++) {
+    int slot = tick % RING_SIZE;
+    checksums_[slot] = getStateChecksum(&states_[slot]);
+    checksumTicks_[slot] = tick;
+  }
+  if (lastFinalTick >= numFinalTicks_) numFinalTicks_ = lastFinalTick + 1;
+
+  // Compare with the peer's, if we have got that far, and still have ours.
+  if (peerChecksumTick_ != -1 && peerChecksumTick_ < numFinalTicks_) {
+    int slot = peerChecksumTick_ % RING_SIZE;
+    if (checksumTicks_[slot] == peerChecksumTick_ && checksums_[slot] != peerChecksum_) {
+      if (!isDesynced_) printf("Netplay games differ from tick %d!\n", peerChecksumTick_);
+      isDesynced_ = true;
+    }
+    peerChecksumTick_ = -1;
+  }
+}
+
+void NetplaySession::sendInputs()
+{
+  uint8_t packet[UdpLink::MAX_PACKET_SIZE];
+  int numInputs = numTicks_ - numInputsAcked_;
+  if (numInputs > UdpLink::MAX_PACKET_SIZE - HEADER_SIZE) {
+    numInputs = UdpLink::MAX_PACKET_SIZE - HEADER_SIZE;
+  }
+  packet[0] = 'P';
+  packet[1] = 'N';
+  packet[2] = (uint8_t)role_;
+  packet[3] = (uint8_t)numInputs;
+  put32(packet + 4, gameId_);
+  put32(packet + 8, (uint32_t)numInputsAcked_);
+  put32(packet + 12, (uint32_t)numRemoteInputs_);
+  put32(packet + 16, (uint32_t)numTicks_);
+  if (numFinalTicks_ > 0) {
+    int slot = (numFinalTicks_ - 1) % RING_SIZE;
+    put32(packet + 20, (uint32_t)(numFinalTicks_ - 1));
+    put32(packet + 24, checksums_[slot]);
+  } else {
+    put32(packet + 20, NO_CHECKSUM);
+    put32(packet + 24, 0);
+  }
+  for (int i = 0; i < numInputs; i++) {
+    packet[HEADER_SIZE + i] = localInputs_[(numInputsAcked_ + i) % RING_SIZE];
+  }
+  link_.send(packet, HEADER_SIZE + numInputs);
+  lastSendTime_ = getMicroseconds();
+}
+
+int NetplaySession::getNumTicks()
+{
+  return numTicks_;
+}
+
+int NetplaySession::getNumConfirmedTicks()
+{
+  return (numRemoteInputs_ < numTicks_) ? numRemoteInputs_ : numTicks_;
+}
+
+int NetplaySession::getAdvantage()
+{
+  return numTicks_ - numRemoteInputs_;
+}
+
+int NetplaySession::getPeerAdvantage()
+{
+  return peerAdvantage_;
+}
+
+bool NetplaySession::isDesynced()
+{
+  return isDesynced_;
+}
+
+int NetplaySession::getNumRollbacks()
+{
+  return numRollbacks_;
+}
+
+int NetplaySession::getNumTicksReplayed()
+{
+  return numTicksReplayed_;
+}
+
+int NetplaySession::getLongestRollback()
+{
+  return longestRollback_;
+}
+
+int NetplaySession::getNumStalls()
+{
+  return numStalls_;
+}
+
+UdpLink *NetplaySession::getLink()
+{
+  return &link_;
+}
@@ -0,0 +1,246 @@
+#ifndef netplay_h
+#define netplay_h
+
+#include <stdint.h>
+#include "direction.h"
+#include "random.h"
+#include "simulation.h"
+
+// Which side of a two player game this peer plays.
+typedef enum {
+  NETPLAY_PACMAN,
+  NETPLAY_GHOST    // Steers ghost 0, Blinky.
+} NetplayRole;
+
+// How to reach the peer, and what to do to packets on the way there.
+struct NetplayOptions {
+  NetplayRole role = NETPLAY_PACMAN;
+  int localPort = 0;
+  const char *remoteHost = "127.0.0.1"; // IPv4 address.
+  int remotePort = 0;
+
+  // Faults injected into every packet we send, for trying out a bad
+  // network over loopback. Each is held back latencyMs, plus up to
+  // jitterMs more at random (so packets can arrive out of order), or
+  // dropped lossPercent of the time.
+  int latencyMs = 0;
+  int jitterMs = 0;
+  int lossPercent = 0;
+};
+
+/**
+ * A non-blocking UDP socket that talks to one peer, with injected
+ * latency, jitter and packet loss.
+ */
+class UdpLink {
+  public:
+    UdpLink();
+    ~UdpLink();
+
+    /**
+     * Bind to options.localPort and talk to the peer in options.
+     * \Returns false if unable to.
+     */
+    bool open(const NetplayOptions &options);
+
+    bool isOpen();
+
+    /**
+     * Send size bytes of data to the peer: now, later, or never, as the
+     * injected faults decide.
+     */
+    void send(const uint8_t *data, int size);
+
+    /**
+     * Send whatever held back packets are due, then take the next packet
+     * from the peer, if any, into data.
+     * \Returns its size, or 0 if there are none waiting.
+     */
+    int receive(uint8_t *data, int maxSize);
+
+    int getNumPacketsSent();
+    int getNumPacketsDropped();
+
+    static const int MAX_PACKET_SIZE = 64;
+
+  private:
+    // Send any held back packets that are due by now.
+    void flush(int64_t now);
+
+    struct HeldPacket {
+      int64_t dueTime;  // In microseconds, see getMicroseconds().
+      int size;
+      uint8_t data[MAX_PACKET_SIZE];
+    };
+    static const int MAX_HELD_PACKETS = 256;
+
+    int socket_;
+    uint32_t remoteAddress_; // Network byte order.
+    uint16_t remotePort_;
+    int latencyUs_;
+    int jitterUs_;
+    int lossPercent_;
+    Random random_;          // For jitter and loss.
+    HeldPacket held_[MAX_HELD_PACKETS];
+    int numHeld_;
+    int numPacketsSent_;
+    int numPacketsDropped_;
+};
+
+/**
+ * Two player rollback netplay: PACMAN on one peer, a ghost on the other,
+ * each peer running the whole game.
+ *
+ * Every tick is stepped as soon as it is due, with our own input for it,
+ * and a guess at the peer's: whatever the peer last sent, as players
+ * mostly hold a direction for many ticks. Our inputs go out in every
+ * packet until the peer says it has them, so losing a packet costs
+ * nothing but time. When the peer's real input for a tick turns out to
+ * differ from the guess, the game is put back to the state it was in
+ * before that tick, saved as a SimulationState, and every tick since is
+ * stepped again with what is now known. So neither player ever waits on
+ * the network, unless the peer falls more than MAX_ROLLBACK_TICKS behind.
+ *
+ * Each side also knows how far ahead of the other it is guessing, and
+ * how far the other is guessing ahead of it. Over a network that is the
+ * same both ways, these come out the same, unless one peer's clock is
+ * ahead, e.g. from starting first. That peer holds back a tick now and
+ * then until they are even, rather than leaving the other player's every
+ * move to be guessed at for as long as the game lasts.
+ *
+ * To catch the two games drifting apart, each packet also carries a
+ * checksum of the latest state that is final on the sender, which the
+ * receiver compares with its own for the same tick.
+ *
+ * Packet format, all integers little-endian:
+ *
+ *   "PN"               magic
+ *   uint8              sender's role
+ *   uint8              number of inputs
+ *   uint32             which game: a hash of its first state, rate and seed
+ *   uint32             tick of the first input
+ *   uint32             ticks of ours the sender has, which it won't
+ *                      be sent again
+ *   uint32             ticks the sender has stepped
+ *   uint32             tick of checksum, 0xFFFFFFFF if none
+ *   uint32             checksum of the sender's state before that tick
+ *   inputs             one byte direction per tick
+ */
+class NetplaySession {
+  public:
+    NetplaySession();
+    ~NetplaySession();
+
+    /**
+     * Start playing the game in simulation, which must not have been
+     * stepped yet, as options.role against the peer in options, which
+     * must have the same level, rate, seed and number of ghosts.
+     * \Returns false if unable to reach the network, or to save states
+     * of this game: it can have at most SimulationState::MAX_GHOSTS
+     * ghosts, on a board of at most SimulationState::MAX_TILE_BYTES
+     * tiles, counting the one tile border around it.
+     */
+    bool start(Simulation *simulation, const NetplayOptions &options);
+
+    bool isStarted();
+
+    /**
+     * Take in what the peer sent, then step the next tick, with direction
+     * for our side, and send it to the peer.
+     * \Returns false, stepping nothing, if the peer is too far behind to
+     * guess at its inputs any more. Try again on the next tick.
+     */
+    bool advance(Direction direction);
+
+    /**
+     * Take in what the peer sent, rolling back and stepping ticks again
+     * if that changes any, and send the peer our inputs it is missing.
+     * Done by advance() too, but can also be called between ticks.
+     */
+    void poll();
+
+    // Ticks stepped so far.
+    int getNumTicks();
+    // Of those, ticks stepped with the peer's real input, not a guess.
+    int getNumConfirmedTicks();
+    // How many ticks we have stepped beyond the peer's last input, or if
+    // negative, how many of its inputs are waiting for us to step; and
+    // the peer's last word on its own.
+    int getAdvantage();
+    int getPeerAdvantage();
+    // Whether a checksum from the peer ever differed from ours.
+    bool isDesynced();
+
+    int getNumRollbacks();
+    int getNumTicksReplayed();  // By rolling back.
+    int getLongestRollback();   // In ticks.
+    int getNumStalls();         // Times advance() held back for the peer.
+    UdpLink *getLink();
+
+    // At most how many ticks ahead of the peer's last input we guess.
+    static const int MAX_ROLLBACK_TICKS = 12;
+
+  private:
+    // Ticks of inputs and states kept. Our inputs are needed back to what
+    // the peer has, which can be up to two rollbacks behind.
+    static const int RING_SIZE = 32;
+    static_assert(RING_SIZE > 2 * MAX_ROLLBACK_TICKS, "RING_SIZE too small");
+
+    // Read every packet waiting, returning the earliest tick stepped
+    // with a wrong guess, or numTicks_ if none.
+    int receivePackets();
+
+    // Put the game back to before tick, and step every tick since again.
+    void rollBack(int tick);
+
+    // Save the state before the next tick, and step it.
+    void step();
+
+    // Checksum the states that have become final since last time.
+    void checksumFinalStates();
+
+    void sendInputs();
+
+    // How often to send the peer our inputs while not stepping ticks.
+    static const int RESEND_INTERVAL_US = 10000;
+
+    Simulation *simulation_;
+    UdpLink link_;
+    NetplayRole role_;
+    uint32_t gameId_;
+
+    int numTicks_;              // Stepped.
+    int numRemoteInputs_;       // Peer's inputs known, for ticks 0 onwards.
+    int numInputsAcked_;        // Our inputs the peer has.
+    int peerNumTicks_;          // As of the peer's newest packet,
+    int peerAdvantage_;         // and its getAdvantage() then.
+    int64_t lastSendTime_;      // In microseconds.
+
+    // Per tick, as tick % RING_SIZE.
+    uint8_t localInputs_[RING_SIZE];
+    uint8_t remoteInputs_[RING_SIZE];
+    uint8_t usedRemoteInputs_[RING_SIZE]; // What each tick was stepped with.
+    SimulationState *states_;             // Before each tick.
+    uint32_t checksums_[RING_SIZE];       // Of final states.
+    int checksumTicks_[RING_SIZE];        // Which tick each is of, -1 if none.
+    int numFinalTicks_;                   // States before ticks up to here
+                                          // are final, and checksummed.
+
+    // The peer's checksum we have yet to compare ours with, -1 if none.
+    int peerChecksumTick_;
+    uint32_t peerChecksum_;
+    bool isDesynced_;
+
+    int numRollbacks_;
+    int numTicksReplayed_;
+    int longestRollback_;
+    int numStalls_;
+};
+
+/**
+ * A checksum of everything state holds, for checking two games are in
+ * exactly the same state.
+ */
+uint32_t getStateChecksum(const SimulationState *state);
+
+#endif /* netplay_h */
@@ -0,0 +1,67 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "occupancy.h"
+
+OccupancyGrid::OccupancyGrid()
+{
+  width_ = 0;
+  height_ = 0;
+  stride_ = 0;
+  firsts_ = NULL;
+  cells_ = NULL;
+  nexts_ = NULL;
+  prevs_ = NULL;
+}
+
+OccupancyGrid::~OccupancyGrid()
+{
+  if (firsts_ != NULL) free(firsts_);
+  if (cells_ != NULL) free(cells_);
+  if (nexts_ != NULL) free(nexts_);
+  if (prevs_ != NULL) free(prevs_);
+}
+
+bool OccupancyGrid::init(int width, int height, int numActors)
+{
+  width_ = width;
+  height_ = height;
+  stride_ = width + 2;
+  int numCells = stride_ * (height + 2);
+  firsts_ = (int *)realloc(firsts_, numCells * sizeof(int));
+  cells_ = (int *)realloc(cells_, numActors * sizeof(int));
+  nexts_ = (int *)realloc(nexts_, numActors * sizeof(int));
+  prevs_ = (int *)realloc(prevs_, numActors * sizeof(int));
+  if (firsts_ == NULL || cells_ == NULL || nexts_ == NULL || prevs_ == NULL) {
+    printf("Failed to allocate memory for occupancy grid!\n");
+    return false;
+  }
+
+  for (int i = 0; i < numCells; i++) firsts_[i] = -1;
+  for (int i = 0; i < numActors; i++) {
+    cells_[i] = -1;
+    nexts_[i] = -1;
+    prevs_[i] = -1;
+  }
+  return true;
+}
+
+void OccupancyGrid::relink(int actor, int cell)
+{
+  // Out of the old cell...
+  int next = nexts_[actor];
+  int prev = prevs_[actor];
+  if (prev != -1) {
+    nexts_[prev] = next;
+  } else if (cells_[actor] != -1) {
+    firsts_[cells_[actor]] = next;
+  }
+  if (next != -1) prevs_[next] = prev;
+
+  // ...and in at the front of the new one.
+  next = firsts_[cell];
+  nexts_[actor] = next;
+  prevs_[actor] = -1;
+  if (next != -1) prevs_[next] = actor;
+  firsts_[cell] = actor;
+  cells_[actor] = cell;
+}
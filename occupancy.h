@@ -0,0 +1,71 @@
+#ifndef occupancy_h
+#define occupancy_h
+
+/**
+ * Which actors are in which tile, so that finding what an actor ran into
+ * means looking at the few actors in its tile, rather than at every actor
+ * in the game.
+ *
+ * Each tile holds a list of the actors in it, linked both ways through
+ * per-actor arrays, so moving an actor to another tile is a handful of
+ * writes and never allocates.
+ *
+ * Like Board, the grid has a border one tile thick. Tiles further off the
+ * board than that (which actors only reach part way through a portal)
+ * share the border tile nearest them, so callers should still check that
+ * each actor found really is in the tile they asked about.
+ */
+class OccupancyGrid {
+  public:
+    OccupancyGrid();
+    ~OccupancyGrid();
+
+    /**
+     * Make room for numActors actors, numbered from 0, on a width x height
+     * board. Actors are in no tile until first moved.
+     * \Returns false if unable to allocate the grid.
+     */
+    bool init(int width, int height, int numActors);
+
+    // Put actor into the given tile, taking it out of whichever it was in.
+    void move(int actor, int tileX, int tileY)
+    {
+      int cell = getCell(tileX, tileY);
+      if (cells_[actor] != cell) relink(actor, cell);
+    }
+
+    // First actor in the given tile, or -1 if there are none.
+    int getFirst(int tileX, int tileY)
+    {
+      return firsts_[getCell(tileX, tileY)];
+    }
+
+    // Actor after the given one in the same tile, or -1 if it was the last.
+    int getNext(int actor)
+    {
+      return nexts_[actor];
+    }
+
+  private:
+    int getCell(int tileX, int tileY)
+    {
+      if (tileX < -1) tileX = -1;
+      if (tileX > width_) tileX = width_;
+      if (tileY < -1) tileY = -1;
+      if (tileY > height_) tileY = height_;
+      return ((tileY + 1) * stride_) + (tileX + 1);
+    }
+
+    // Unlink actor from its cell, if any, and link it in at the front of cell.
+    void relink(int actor, int cell);
+
+    int width_;
+    int height_;
+    int stride_;    // Cells from one row to the next, including the border.
+    int *firsts_;   // Per cell, first actor in it, -1 if none.
+    int *cells_;    // Per actor, cell it is in, -1 if none.
+    int *nexts_;    // Per actor, next and previous actor in the same cell,
+    int *prevs_;    // -1 at either end.
+};
+
+#endif /* occupancy_h */
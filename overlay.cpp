@@ -0,0 +1,105 @@
+#include <stdio.h>
+#include <string.h>
+#include "overlay.h"
+
+/**
+ * Returns the 3x5 glyph for the given character, five rows of three
+ * bits each, top row in the highest bits. Unknown characters are blank.
+ */
+static Uint16 getGlyph(char c)
+{
+  static const Uint16 digits[10] = {
+    075557, 026227, 071747, 071717, 055711,
+    074717, 074757, 071111, 075757, 075717
+  };
+  static const Uint16 letters[26] = {
+    025755, 065656, 034443, 065556, 074647, 074644, 034553, 055755, 072227,
+    011152, 055655, 044447, 057755, 065555, 025552, 065644, 025563, 065655,
+    034216, 072222, 055557, 055552, 055775, 055255, 055222, 071247
+  };
+  if (c >= '0' && c <= '9') return digits[c - '0'];
+  if (c >= 'A' && c <= 'Z') return letters[c - 'A'];
+  if (c >= 'a' && c <= 'z') return letters[c - 'a'];
+  if (c == '.') return 000002;
+  if (c == ':') return 002020;
+  if (c == '/') return 011244;
+  if (c == '%') return 051245;
+  return 0;
+}
+
+PerformanceOverlay::PerformanceOverlay()
+{
+  numLines_ = 0;
+  numRects_ = 0;
+}
+
+PerformanceOverlay::~PerformanceOverlay() {}
+
+void PerformanceOverlay::update(Histogram *histograms, const char **names, int numHistograms)
+{
+  numLines_ = 0;
+  snprintf(lines_[numLines_++], MAX_LINE_LENGTH, "%-8s%6s%6s%6s%6s", "US", "P50", "P95", "P99", "MAX");
+  for (int i = 0; i < numHistograms && numLines_ < MAX_LINES; i++) {
+    Histogram *histogram = &histograms[i];
+    snprintf(lines_[numLines_++], MAX_LINE_LENGTH, "%-8s%6u%6u%6u%6u", names[i],
+             histogram->getPercentile(50), histogram->getPercentile(95),
+             histogram->getPercentile(99), histogram->getMax());
+  }
+}
+
+void PerformanceOverlay::render(SDL_Renderer *renderer)
+{
+  if (numLines_ == 0) {
+    return;
+  }
+  
+  // Each character is 3 font pixels wide plus 1 of spacing,
+  // and each line 5 font pixels high plus 2 of spacing.
+  int charWidth = 4 * SCALE;
+  int lineHeight = 7 * SCALE;
+  int margin = 2 * SCALE;
+  
+  // Darken what is behind the table so it can be read over the maze.
+  int longestLine = 0;
+  for (int i = 0; i < numLines_; i++) {
+    int length = (int)strlen(lines_[i]);
+    if (length > longestLine) longestLine = length;
+  }
+  SDL_Rect background = {
+    .x = 0, .y = 0,
+    .w = longestLine * charWidth + (2 * margin),
+    .h = numLines_ * lineHeight + (2 * margin)
+  };
+  SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+  SDL_SetRenderDrawColor(renderer, 0x00, 0x00, 0x00, 0xC0);
+  SDL_RenderFillRect(renderer, &background);
+  SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+  
+  // Then draw every lit font pixel of the table in one call.
+  numRects_ = 0;
+  for (int i = 0; i < numLines_; i++) {
+    drawText(lines_[i], margin, margin + (i * lineHeight));
+  }
+  SDL_SetRenderDrawColor(renderer, 0xFF, 0xFF, 0x00, 0xFF);
+  SDL_RenderFillRects(renderer, rects_, numRects_);
+}
+
+void PerformanceOverlay::drawText(const char *text, int x, int y)
+{
+  for (int i = 0; text[i] != '\0'; i++) {
+    Uint16 glyph = getGlyph(text[i]);
+    for (int row = 0; row < 5; row++) {
+      for (int col = 0; col < 3; col++) {
+        // Is this font pixel lit?
+        int bit = ((4 - row) * 3) + (2 - col);
+        if (((glyph >> bit) & 1) == 0 || numRects_ == MAX_RECTS) {
+          continue;
+        }
+        rects_[numRects_++] = {
+          .x = x + (((i * 4) + col) * SCALE), .y = y + (row * SCALE),
+          .w = SCALE, .h = SCALE
+        };
+      }
+    }
+  }
+}
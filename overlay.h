@@ -0,0 +1,46 @@
+#ifndef overlay_h
+#define overlay_h
+
+#include <SDL2/SDL.h>
+
+#include "histogram.h"
+
+/**
+ * On-screen table of p50/p95/p99/max per frame phase, drawn with a tiny
+ * built-in 3x5 pixel font straight onto the renderer, so it needs no
+ * font files and never allocates.
+ */
+class PerformanceOverlay {
+  public:
+    PerformanceOverlay();
+    ~PerformanceOverlay();
+    
+    /**
+     * Re-read the given histograms into the table. Percentiles are cheap
+     * but not free, so callers should do this a few times a second
+     * rather than every frame.
+     */
+    void update(Histogram *histograms, const char **names, int numHistograms);
+    
+    // Draw the table in the top left corner of the renderer's target.
+    void render(SDL_Renderer *renderer);
+    
+  private:
+    // Queue up the pixels of the given text, top left corner at (x,y).
+    void drawText(const char *text, int x, int y);
+    
+    static const int MAX_LINES = 8;
+    static const int MAX_LINE_LENGTH = 40;
+    static const int MAX_RECTS = MAX_LINES * MAX_LINE_LENGTH * 15;
+    
+    // Size of one font pixel on screen.
+    static const int SCALE = 2;
+    
+    char lines_[MAX_LINES][MAX_LINE_LENGTH];
+    int numLines_;
+    
+    SDL_Rect rects_[MAX_RECTS];
+    int numRects_;
+};
+
+#endif /* overlay_h */
@@ -0,0 +1,230 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <new>
+#include "batch.h"
+#include "pacman_env.h"
+
+static const int PLANE_SIZE = PACMAN_ENV_WIDTH * PACMAN_ENV_HEIGHT;
+
+struct PacmanVecEnv {
+  BatchSimulation *batch;
+  int numEnvs;
+  bool isAutoReset;      // Reset games as soon as they end.
+  uint32_t *seeds;       // Seed each game was last reset with.
+  int *numSteps;         // Steps since each game was last reset.
+  int *lastPellets;      // Pellets eaten before this step, for rewards.
+  Direction *directions; // Actions of this step.
+};
+
+// One game is a batch of one, which just isn't reset automatically.
+struct PacmanEnv {
+  PacmanVecEnv *vec;
+};
+
+static void destroyVecEnv(PacmanVecEnv *env)
+{
+  if (env->batch != NULL) delete env->batch;
+  if (env->seeds != NULL) free(env->seeds);
+  if (env->numSteps != NULL) free(env->numSteps);
+  if (env->lastPellets != NULL) free(env->lastPellets);
+  if (env->directions != NULL) free(env->directions);
+  free(env);
+}
+
+static PacmanVecEnv *createVecEnv(int numEnvs, uint32_t firstSeed, bool isAutoReset)
+{
+  if (numEnvs < 1) {
+    printf("Need at least one environment!\n");
+    return NULL;
+  }
+  PacmanVecEnv *env = (PacmanVecEnv *)malloc(sizeof(PacmanVecEnv));
+  if (env == NULL) {
+    printf("Failed to allocate memory for environments!\n");
+    return NULL;
+  }
+  env->numEnvs = numEnvs;
+  env->isAutoReset = isAutoReset;
+  // Nothing may throw out through the C interface.
+  env->batch = new (std::nothrow) BatchSimulation(numEnvs);
+  env->seeds = (uint32_t *)malloc(numEnvs * sizeof(uint32_t));
+  env->numSteps = (int *)malloc(numEnvs * sizeof(int));
+  env->lastPellets = (int *)malloc(numEnvs * sizeof(int));
+  env->directions = (Direction *)malloc(numEnvs * sizeof(Direction));
+
+  bool success = env->batch != NULL && env->batch->getSuccess();
+  if (env->batch == NULL || env->seeds == NULL || env->numSteps == NULL ||
+      env->lastPellets == NULL || env->directions == NULL) {
+    printf("Failed to allocate memory for environments!\n");
+    success = false;
+  }
+  if (success && (env->batch->getBoardWidth() != PACMAN_ENV_WIDTH ||
+                  env->batch->getBoardHeight() != PACMAN_ENV_HEIGHT)) {
+    printf("Level is %dx%d tiles, observations are %dx%d!\n",
+           env->batch->getBoardWidth(), env->batch->getBoardHeight(),
+           PACMAN_ENV_WIDTH, PACMAN_ENV_HEIGHT);
+    success = false;
+  }
+  if (!success) {
+    destroyVecEnv(env);
+    return NULL;
+  }
+
+  for (int i = 0; i < numEnvs; i++) {
+    env->seeds[i] = firstSeed + (uint32_t)i;
+    env->numSteps[i] = 0;
+    env->lastPellets[i] = 0;
+    env->batch->reset(i, env->seeds[i]);
+  }
+  return env;
+}
+
+/**
+ * Start game i again with its next seed. A game that hasn't been stepped
+ * since it was last reset is already as new, so is left as it is.
+ */
+static void resetGame(PacmanVecEnv *env, int i)
+{
+  if (env->numSteps[i] == 0) return;
+  env->seeds[i] += (uint32_t)env->numEnvs;
+  env->numSteps[i] = 0;
+  env->lastPellets[i] = 0;
+  env->batch->reset(i, env->seeds[i]);
+}
+
+// Write the planes of game i to observation.
+static void observe(BatchSimulation *batch, int game, uint8_t *observation)
+{
+  memset(observation, 0, PACMAN_ENV_OBSERVATION_SIZE);
+
+  uint8_t *walls = observation + (PACMAN_ENV_PLANE_WALLS * PLANE_SIZE);
+  uint8_t *pellets = observation + (PACMAN_ENV_PLANE_PELLETS * PLANE_SIZE);
+  uint8_t *powerPellets = observation + (PACMAN_ENV_PLANE_POWER_PELLETS * PLANE_SIZE);
+  for (int y = 0; y < PACMAN_ENV_HEIGHT; y++) {
+    for (int x = 0; x < PACMAN_ENV_WIDTH; x++) {
+      TileType tile = batch->getTile(game, x, y);
+      int i = (y * PACMAN_ENV_WIDTH) + x;
+      walls[i] = (tile == TILE_WALL || tile == TILE_GATE);
+      pellets[i] = (tile == TILE_PELLET);
+      powerPellets[i] = (tile == TILE_POWER_PELLET);
+    }
+  }
+
+  for (int slot = 0; slot < NUM_SLOTS; slot++) {
+    int plane;
+    if (slot == SLOT_PACMAN) {
+      plane = PACMAN_ENV_PLANE_PACMAN;
+    } else {
+      plane = PACMAN_ENV_PLANE_GHOSTS_WAITING + (int)batch->getState(game, (ActorSlot)slot);
+    }
+    int tileSize = Simulation::TILE_SIZE;
+    int tileX = (batch->getX(game, (ActorSlot)slot) + (tileSize / 2)) / tileSize;
+    int tileY = (batch->getY(game, (ActorSlot)slot) + (tileSize / 2)) / tileSize;
+    // Half way through a portal, the centre can be just off the board.
+    if (tileX < 0) tileX = 0;
+    if (tileX > PACMAN_ENV_WIDTH - 1) tileX = PACMAN_ENV_WIDTH - 1;
+    if (tileY < 0) tileY = 0;
+    if (tileY > PACMAN_ENV_HEIGHT - 1) tileY = PACMAN_ENV_HEIGHT - 1;
+    observation[(plane * PLANE_SIZE) + (tileY * PACMAN_ENV_WIDTH) + tileX] = 1;
+  }
+}
+
+static void observeAll(PacmanVecEnv *env, uint8_t *observations)
+{
+  if (observations == NULL) return;
+  for (int i = 0; i < env->numEnvs; i++) {
+    observe(env->batch, i, observations + ((size_t)i * PACMAN_ENV_OBSERVATION_SIZE));
+  }
+}
+
+/* Many games. */
+
+PacmanVecEnv *pacman_vec_env_create(int numEnvs, uint32_t firstSeed)
+{
+  return createVecEnv(numEnvs, firstSeed, true);
+}
+
+void pacman_vec_env_destroy(PacmanVecEnv *env)
+{
+  if (env != NULL) destroyVecEnv(env);
+}
+
+int pacman_vec_env_get_num_envs(PacmanVecEnv *env)
+{
+  return env->numEnvs;
+}
+
+void pacman_vec_env_reset(PacmanVecEnv *env, int index, uint8_t *observations)
+{
+  if (index == -1) {
+    for (int i = 0; i < env->numEnvs; i++) resetGame(env, i);
+  } else if (index >= 0 && index < env->numEnvs) {
+    resetGame(env, index);
+  }
+  observeAll(env, observations);
+}
+
+void pacman_vec_env_step(PacmanVecEnv *env, const int *actions,
+                         float *rewards, uint8_t *dones, uint8_t *observations)
+{
+  for (int i = 0; i < env->numEnvs; i++) {
+    int action = actions[i];
+    if (action < 0 || action >= PACMAN_ENV_NUM_ACTIONS) action = PACMAN_ENV_ACTION_NONE;
+    // Actions are numbered as Directions.
+    env->directions[i] = (Direction)action;
+  }
+
+  env->batch->step(env->directions);
+
+  for (int i = 0; i < env->numEnvs; i++) {
+    int pellets = env->batch->getPellets(i);
+    rewards[i] = (float)(pellets - env->lastPellets[i]);
+    env->lastPellets[i] = pellets;
+    env->numSteps[i]++;
+    dones[i] = PACMAN_ENV_RUNNING;
+    if (env->batch->isGameOver(i)) {
+      dones[i] = env->batch->isGameOverWin(i) ? PACMAN_ENV_WON : PACMAN_ENV_LOST;
+      if (env->isAutoReset) resetGame(env, i);
+    }
+  }
+
+  observeAll(env, observations);
+}
+
+/* One game. */
+
+PacmanEnv *pacman_env_create(uint32_t seed)
+{
+  PacmanEnv *env = (PacmanEnv *)malloc(sizeof(PacmanEnv));
+  if (env == NULL) {
+    printf("Failed to allocate memory for environment!\n");
+    return NULL;
+  }
+  env->vec = createVecEnv(1, seed, false);
+  if (env->vec == NULL) {
+    free(env);
+    return NULL;
+  }
+  return env;
+}
+
+void pacman_env_destroy(PacmanEnv *env)
+{
+  if (env == NULL) return;
+  destroyVecEnv(env->vec);
+  free(env);
+}
+
+void pacman_env_reset(PacmanEnv *env, uint8_t *observation)
+{
+  pacman_vec_env_reset(env->vec, 0, observation);
+}
+
+float pacman_env_step(PacmanEnv *env, int action, int *done, uint8_t *observation)
+{
+  float reward;
+  uint8_t result;
+  pacman_vec_env_step(env->vec, &action, &reward, &result, observation);
+  if (done != NULL) *done = (result != PACMAN_ENV_RUNNING);
+  return reward;
+}
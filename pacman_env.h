@@ -0,0 +1,133 @@
+#ifndef pacman_env_h
+#define pacman_env_h
+
+/*
+ * A C interface to the game for training agents: reset, step with an
+ * action, get back a reward and whether the game is over, with the board
+ * written straight into the caller's own buffers as a stack of planes.
+ * No window, no frame cap, and no allocations after creation.
+ *
+ * Build as a shared library with:
+ *   cmake --build build --target pacman_env
+ */
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Size of one plane of an observation, the default level in tiles. */
+#define PACMAN_ENV_WIDTH 28
+#define PACMAN_ENV_HEIGHT 36
+
+/*
+ * Planes of an observation, in order. Each is PACMAN_ENV_HEIGHT rows of
+ * PACMAN_ENV_WIDTH bytes, 1 where the plane's thing is in the tile and 0
+ * elsewhere. An actor is in the tile its centre is in. The ghost planes
+ * are one per ghost state, in the order of GHOST_STATE, so a plane can
+ * hold more than one ghost. Ghosts are waiting until PACMAN first moves.
+ */
+enum {
+  PACMAN_ENV_PLANE_WALLS,          /* Walls and the gates of the base. */
+  PACMAN_ENV_PLANE_PELLETS,
+  PACMAN_ENV_PLANE_POWER_PELLETS,
+  PACMAN_ENV_PLANE_PACMAN,
+  PACMAN_ENV_PLANE_GHOSTS_WAITING,
+  PACMAN_ENV_PLANE_GHOSTS_CHASE,
+  PACMAN_ENV_PLANE_GHOSTS_SCATTER,
+  PACMAN_ENV_PLANE_GHOSTS_EATEN,
+  PACMAN_ENV_PLANE_GHOSTS_FRIGHTENED,
+  PACMAN_ENV_PLANE_GHOSTS_FINDING_SPOT,
+  PACMAN_ENV_PLANE_GHOSTS_FINDING_EXIT,
+  PACMAN_ENV_NUM_PLANES
+};
+
+/* Bytes in one observation. */
+#define PACMAN_ENV_OBSERVATION_SIZE \
+  (PACMAN_ENV_NUM_PLANES * PACMAN_ENV_HEIGHT * PACMAN_ENV_WIDTH)
+
+/*
+ * Actions, as the arrow keys. PACMAN_ENV_ACTION_NONE keeps going the same
+ * way. A turn into a wall is ignored, as when playing.
+ */
+enum {
+  PACMAN_ENV_ACTION_NONE,
+  PACMAN_ENV_ACTION_UP,
+  PACMAN_ENV_ACTION_DOWN,
+  PACMAN_ENV_ACTION_LEFT,
+  PACMAN_ENV_ACTION_RIGHT,
+  PACMAN_ENV_NUM_ACTIONS
+};
+
+/* Whether a game is over, and how it ended. */
+enum {
+  PACMAN_ENV_RUNNING,
+  PACMAN_ENV_LOST,
+  PACMAN_ENV_WON
+};
+
+/* The reward for a step is the number of pellets eaten during it. */
+
+/* ---- One game. ---- */
+
+typedef struct PacmanEnv PacmanEnv;
+
+/*
+ * Create a game, at 60 steps per second of game time. Frightened ghosts
+ * use random numbers from seed; each reset moves on to the next seed, so
+ * seed, seed + 1, seed + 2, ... are played in turn.
+ * Returns NULL if unable to.
+ */
+PacmanEnv *pacman_env_create(uint32_t seed);
+void pacman_env_destroy(PacmanEnv *env);
+
+/*
+ * Start a new game, writing its first observation to observation,
+ * PACMAN_ENV_OBSERVATION_SIZE bytes, unless NULL.
+ */
+void pacman_env_reset(PacmanEnv *env, uint8_t *observation);
+
+/*
+ * Play one step with the given action, writing the observation after it
+ * to observation unless NULL, and whether the game is over to done
+ * unless NULL. Once the game is over, steps change nothing until reset.
+ * Returns the reward.
+ */
+float pacman_env_step(PacmanEnv *env, int action, int *done, uint8_t *observation);
+
+/* ---- Many games, stepped together in one call. ---- */
+
+typedef struct PacmanVecEnv PacmanVecEnv;
+
+/*
+ * Create numEnvs games, game i starting with seed firstSeed + i. A game
+ * that ends is reset straight away, with the seed numEnvs beyond its last,
+ * so no seed is played twice. Returns NULL if unable to.
+ */
+PacmanVecEnv *pacman_vec_env_create(int numEnvs, uint32_t firstSeed);
+void pacman_vec_env_destroy(PacmanVecEnv *env);
+
+int pacman_vec_env_get_num_envs(PacmanVecEnv *env);
+
+/*
+ * Start a new game in env number index, or in every env if index is -1,
+ * and write the observations of every env to observations unless NULL.
+ */
+void pacman_vec_env_reset(PacmanVecEnv *env, int index, uint8_t *observations);
+
+/*
+ * Play one step of every game, game i with actions[i]. Writes, for each
+ * game i, its reward to rewards[i], how it ended (PACMAN_ENV_RUNNING if it
+ * didn't) to dones[i], and its observation to observations unless NULL,
+ * at an offset of i * PACMAN_ENV_OBSERVATION_SIZE. The observation of a
+ * game that ended is that of the new game it was reset to.
+ */
+void pacman_vec_env_step(PacmanVecEnv *env, const int *actions,
+                         float *rewards, uint8_t *dones, uint8_t *observations);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* pacman_env_h */
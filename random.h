@@ -0,0 +1,45 @@
+#ifndef random_h
+#define random_h
+
+#include <stdint.h>
+
+/**
+ * A small, fast pseudo-random number generator (xorshift32) with its own
+ * state, so that two simulations given the same seed make exactly the same
+ * choices, no matter what else in the program is drawing random numbers.
+ */
+class Random {
+  public:
+    Random(uint32_t seed = 1)
+    {
+      setSeed(seed);
+    }
+    
+    void setSeed(uint32_t seed)
+    {
+      // Scramble the seed, so that nearby seeds don't give
+      // nearby sequences. Xorshift can't leave a state of 0.
+      state_ = (seed ^ 0x9E3779B9u) * 0x85EBCA6Bu;
+      state_ ^= state_ >> 16;
+      if (state_ == 0) state_ = 1;
+    }
+    
+    uint32_t next()
+    {
+      state_ ^= state_ << 13;
+      state_ ^= state_ >> 17;
+      state_ ^= state_ << 5;
+      return state_;
+    }
+    
+    // A number from 0 to n - 1, for small n.
+    int nextInt(int n)
+    {
+      return (int)(next() % (uint32_t)n);
+    }
+    
+  private:
+    uint32_t state_;
+};
+
+#endif /* random_h */
@@ -0,0 +1,264 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "rasterizer.h"
+#include "scene.h"
+#include "simulation.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+static const int TILE_SIZE = Simulation::TILE_SIZE;
+
+// Colours the screen is cleared to, as RGBA8888.
+static const uint32_t BACKGROUND_COLOUR = 0x000000FF;
+static const uint32_t GAME_OVER_WIN_COLOUR = 0x000000FF;
+static const uint32_t GAME_OVER_LOSS_COLOUR = 0x333333FF;
+
+/**
+ * Copy width pixels of a sprite's row over a row of the frame, skipping
+ * the transparent ones (alpha, the low byte, of 0).
+ */
+static inline void blendRow(uint32_t *dst, const uint32_t *src, int width)
+{
+  int i = 0;
+#if defined(__SSE2__)
+  const __m128i alphaMask = _mm_set1_epi32(0xFF);
+  for (; i + 4 <= width; i += 4) {
+    __m128i from = _mm_loadu_si128((const __m128i *)(src + i));
+    __m128i to = _mm_loadu_si128((const __m128i *)(dst + i));
+    __m128i isClear = _mm_cmpeq_epi32(_mm_and_si128(from, alphaMask), _mm_setzero_si128());
+    to = _mm_or_si128(_mm_andnot_si128(isClear, from), _mm_and_si128(isClear, to));
+    _mm_storeu_si128((__m128i *)(dst + i), to);
+  }
+#elif defined(__ARM_NEON)
+  const uint32x4_t alphaMask = vdupq_n_u32(0xFF);
+  for (; i + 4 <= width; i += 4) {
+    uint32x4_t from = vld1q_u32(src + i);
+    uint32x4_t to = vld1q_u32(dst + i);
+    vst1q_u32(dst + i, vbslq_u32(vtstq_u32(from, alphaMask), from, to));
+  }
+#endif
+  for (; i < width; i++) {
+    if (src[i] & 0xFF) dst[i] = src[i];
+  }
+}
+
+// Blend numRows rows of a sprite WIDTH pixels wide, for the sizes every
+// sprite comes in, so each row is fully unrolled.
+template <int WIDTH>
+static void blendRows(uint32_t *dst, int dstPitch, const uint32_t *src, int numRows)
+{
+  for (int row = 0; row < numRows; row++) {
+    blendRow(dst, src, WIDTH);
+    dst += dstPitch;
+    src += ATLAS_WIDTH;
+  }
+}
+
+// Any other width, for sprites cut off by the edge of the frame.
+static void blendRows(uint32_t *dst, int dstPitch, const uint32_t *src, int numRows, int width)
+{
+  for (int row = 0; row < numRows; row++) {
+    blendRow(dst, src, width);
+    dst += dstPitch;
+    src += ATLAS_WIDTH;
+  }
+}
+
+static void fillRows(uint32_t *pixels, int width, int firstRow, int endRow, uint32_t colour)
+{
+  for (int i = firstRow * width; i < endRow * width; i++) {
+    pixels[i] = colour;
+  }
+}
+
+Rasterizer::Rasterizer()
+{
+  width_ = 0;
+  height_ = 0;
+  boardWidth_ = 0;
+  boardHeight_ = 0;
+  numGhosts_ = 0;
+  pixels_ = NULL;
+  mazePixels_ = NULL;
+}
+
+Rasterizer::~Rasterizer()
+{
+  if (pixels_ != NULL) free(pixels_);
+  if (mazePixels_ != NULL) free(mazePixels_);
+}
+
+bool Rasterizer::init(Level *level, int numGhosts)
+{
+  boardWidth_ = level->getWidth();
+  boardHeight_ = level->getHeight();
+  width_ = TILE_SIZE * boardWidth_;
+  height_ = TILE_SIZE * boardHeight_;
+  numGhosts_ = numGhosts;
+  pixels_ = (uint32_t *)realloc(pixels_, width_ * height_ * sizeof(uint32_t));
+  mazePixels_ = (uint32_t *)realloc(mazePixels_, width_ * height_ * sizeof(uint32_t));
+  if (pixels_ == NULL || mazePixels_ == NULL) {
+    printf("Failed to allocate memory for frame!\n");
+    return false;
+  }
+
+  // Walls never change, so are drawn once here, and copied into every frame.
+  fillRows(mazePixels_, width_, 0, height_, BACKGROUND_COLOUR);
+  for (int y = 0; y < boardHeight_; y++) {
+    for (int x = 0; x < boardWidth_; x++) {
+      SpriteId sprite = getWallSpriteId(level->getWallSprite(x, y));
+      if (sprite != NUM_SPRITES) {
+        drawSprite(mazePixels_, sprite, x * TILE_SIZE, y * TILE_SIZE, 0, height_);
+      }
+    }
+  }
+  return true;
+}
+
+// What to draw, for each thread drawing a band of it.
+struct RenderJob {
+  Rasterizer *rasterizer;
+  const Snapshot *snapshot;
+  int height;
+};
+
+static void renderBand(void *arg, int band, int)
+{
+  RenderJob *job = (RenderJob *)arg;
+  int firstRow = band * Rasterizer::BAND_HEIGHT;
+  int endRow = firstRow + Rasterizer::BAND_HEIGHT;
+  if (endRow > job->height) endRow = job->height;
+  job->rasterizer->renderRows(job->snapshot, firstRow, endRow);
+}
+
+void Rasterizer::render(const Snapshot *snapshot, ThreadPool *pool)
+{
+  if (pool == NULL || pool->getNumThreads() == 1) {
+    renderRows(snapshot, 0, height_);
+    return;
+  }
+  RenderJob job = { this, snapshot, height_ };
+  pool->run((height_ + BAND_HEIGHT - 1) / BAND_HEIGHT, renderBand, &job);
+}
+
+void Rasterizer::renderRows(const Snapshot *snapshot, int firstRow, int endRow)
+{
+  // Draw the game over screen instead, if is game over.
+  if (snapshot->isGameOver) {
+    uint32_t colour = snapshot->isGameOverWin ? GAME_OVER_WIN_COLOUR : GAME_OVER_LOSS_COLOUR;
+    fillRows(pixels_, width_, firstRow, endRow, colour);
+    return;
+  }
+
+  // Draw the maze, which also clears the frame.
+  memcpy(pixels_ + (firstRow * width_), mazePixels_ + (firstRow * width_),
+         (endRow - firstRow) * width_ * sizeof(uint32_t));
+
+  // Draw remaining pellets, on top of maze.
+  int firstTileY = firstRow / TILE_SIZE;
+  int lastTileY = (endRow - 1) / TILE_SIZE;
+  for (int j = firstTileY; j <= lastTileY; j++) {
+    for (int i = 0; i < boardWidth_; i++) {
+      TileType tile = (TileType)snapshot->tiles[(j * boardWidth_) + i];
+      SpriteId sprite = getPelletSprite(tile, snapshot->pelletAnimationFrame);
+      if (sprite != NUM_SPRITES) {
+        drawSprite(pixels_, sprite, i * TILE_SIZE, j * TILE_SIZE, firstRow, endRow);
+      }
+    }
+  }
+
+  // Draw actors, on top of board, in the same order as Game does.
+  const ActorSnapshot &pacman = snapshot->pacman;
+  drawSprite(pixels_, getPacmanSprite(*snapshot),
+             pacman.x - (TILE_SIZE / 2), pacman.y - (TILE_SIZE / 2), firstRow, endRow);
+  for (int i = 0; i < numGhosts_; i++) {
+    const ActorSnapshot &ghost = snapshot->ghosts[i];
+    int x = ghost.x - (TILE_SIZE / 2);
+    int y = ghost.y - (TILE_SIZE / 2);
+    SpriteId sprite = getGhostSprite(*snapshot, i);
+    if (sprite != NUM_SPRITES) {
+      drawSprite(pixels_, sprite, x, y, firstRow, endRow);
+    }
+    drawSprite(pixels_, getGhostTargetSprite(i),
+               ghost.targetTileX * TILE_SIZE, ghost.targetTileY * TILE_SIZE, firstRow, endRow);
+    SpriteId eyes = getGhostEyesSprite(ghost);
+    if (eyes != NUM_SPRITES) {
+      drawSprite(pixels_, eyes, x, y, firstRow, endRow);
+    }
+  }
+}
+
+void Rasterizer::drawSprite(uint32_t *pixels, SpriteId sprite, int x, int y, int firstRow, int endRow)
+{
+  // Only the part of the sprite inside the frame and these rows is drawn.
+  const SpriteRect &rect = SPRITE_RECTS[sprite];
+  int top = (y > firstRow) ? y : firstRow;
+  int bottom = (y + rect.h < endRow) ? y + rect.h : endRow;
+  int left = (x > 0) ? x : 0;
+  int right = (x + rect.w < width_) ? x + rect.w : width_;
+  if (top >= bottom || left >= right) {
+    return;
+  }
+
+  const uint32_t *src = &ATLAS_PIXELS[((rect.y + top - y) * ATLAS_WIDTH) + rect.x + (left - x)];
+  uint32_t *dst = &pixels[(top * width_) + left];
+  int width = right - left;
+  if (width == TILE_SIZE) {
+    blendRows<TILE_SIZE>(dst, width_, src, bottom - top);
+  } else if (width == 2 * TILE_SIZE) {
+    blendRows<2 * TILE_SIZE>(dst, width_, src, bottom - top);
+  } else {
+    blendRows(dst, width_, src, bottom - top, width);
+  }
+}
+
+bool Rasterizer::savePpm(const char *path)
+{
+  FILE *file = fopen(path, "wb");
+  if (file == NULL) {
+    printf("Unable to open '%s' for writing!\n", path);
+    return false;
+  }
+  uint8_t *row = (uint8_t *)malloc(width_ * 3);
+  if (row == NULL) {
+    printf("Failed to allocate memory for image!\n");
+    fclose(file);
+    return false;
+  }
+
+  bool success = true;
+  fprintf(file, "P6\n%d %d\n255\n", width_, height_);
+  for (int y = 0; y < height_; y++) {
+    for (int x = 0; x < width_; x++) {
+      uint32_t pixel = pixels_[(y * width_) + x];
+      row[(x * 3) + 0] = (uint8_t)(pixel >> 24);
+      row[(x * 3) + 1] = (uint8_t)(pixel >> 16);
+      row[(x * 3) + 2] = (uint8_t)(pixel >> 8);
+    }
+    if (fwrite(row, 3, width_, file) != (size_t)width_) success = false;
+  }
+  free(row);
+  if (fclose(file) != 0) success = false;
+  if (!success) printf("Failed to write '%s'!\n", path);
+  return success;
+}
+
+const uint32_t *Rasterizer::getPixels()
+{
+  return pixels_;
+}
+
+int Rasterizer::getWidth()
+{
+  return width_;
+}
+
+int Rasterizer::getHeight()
+{
+  return height_;
+}
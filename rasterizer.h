@@ -0,0 +1,77 @@
+#ifndef rasterizer_h
+#define rasterizer_h
+
+#include <stdint.h>
+#include "level.h"
+#include "snapshot.h"
+#include "sprites.h"
+#include "threadpool.h"
+
+/**
+ * Draws the same scene as Game::render(), but into a plain block of
+ * memory rather than through SDL, for getting frames out of games run
+ * with no display (thumbnails of replays, checking frames against known
+ * good ones).
+ *
+ * Pixels are 32-bit SDL_PIXELFORMAT_RGBA8888, as in the sprite atlas.
+ * Atlas pixels are either opaque or fully transparent, so sprites are
+ * drawn by copying just their opaque pixels, four at a time with SSE2 or
+ * NEON, which gives exactly what SDL's blending would.
+ *
+ * A frame is drawn in bands of rows that share nothing, so can be drawn
+ * on as many threads as there are bands.
+ */
+class Rasterizer {
+  public:
+    Rasterizer();
+    ~Rasterizer();
+
+    /**
+     * Set up drawing snapshots of games of the given level, against the
+     * given number of ghosts. The level is only read here.
+     * \Returns false if unable to allocate the frame.
+     */
+    bool init(Level *level, int numGhosts);
+
+    /**
+     * Draw snapshot into the frame, spread over pool's threads if not
+     * NULL, returning once it is all drawn.
+     */
+    void render(const Snapshot *snapshot, ThreadPool *pool = NULL);
+
+    // Draw just the rows from firstRow up to endRow of the frame.
+    void renderRows(const Snapshot *snapshot, int firstRow, int endRow);
+
+    /**
+     * Write the frame out as a binary PPM image.
+     * \Returns false if unable to.
+     */
+    bool savePpm(const char *path);
+
+    // The frame, row by row with no padding.
+    const uint32_t *getPixels();
+    int getWidth();
+    int getHeight();
+
+    // Rows in each band of a frame drawn over many threads.
+    static const int BAND_HEIGHT = 48;
+
+  private:
+    /**
+     * Draw the opaque pixels of the given sprite from the atlas with its
+     * top left corner at (x,y) of pixels, a frame as big as ours, but
+     * only the part from firstRow up to endRow.
+     */
+    void drawSprite(uint32_t *pixels, SpriteId sprite, int x, int y, int firstRow, int endRow);
+
+    int width_;                // In pixels.
+    int height_;
+    int boardWidth_;           // In tiles.
+    int boardHeight_;
+    int numGhosts_;
+    uint32_t *pixels_;         // The frame.
+    uint32_t *mazePixels_;     // Just the walls and gates, on black,
+                               // copied in to start every frame.
+};
+
+#endif /* rasterizer_h */
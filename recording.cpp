@@ -0,0 +1,288 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "recording.h"
+
+static const char MAGIC[4] = { 'P', 'M', 'R', 'C' };
+
+// Little-endian integer and varint helpers. The read helpers return
+// false at end of file, leaving the value unset.
+
+static void writeU16(FILE *file, uint16_t value)
+{
+  fputc(value & 0xFF, file);
+  fputc((value >> 8) & 0xFF, file);
+}
+
+static void writeU32(FILE *file, uint32_t value)
+{
+  for (int i = 0; i < 4; i++) fputc((value >> (8 * i)) & 0xFF, file);
+}
+
+static void writeVarint(FILE *file, uint32_t value)
+{
+  while (value >= 0x80) {
+    fputc((value & 0x7F) | 0x80, file);
+    value >>= 7;
+  }
+  fputc(value, file);
+}
+
+static bool readU16(FILE *file, uint16_t *value)
+{
+  int low = fgetc(file);
+  int high = fgetc(file);
+  if (high == EOF) return false;
+  *value = (uint16_t)(low | (high << 8));
+  return true;
+}
+
+static bool readU32(FILE *file, uint32_t *value)
+{
+  uint32_t result = 0;
+  for (int i = 0; i < 4; i++) {
+    int byte = fgetc(file);
+    if (byte == EOF) return false;
+    result |= (uint32_t)byte << (8 * i);
+  }
+  *value = result;
+  return true;
+}
+
+static bool readVarint(FILE *file, uint32_t *value)
+{
+  uint32_t result = 0;
+  for (int shift = 0; shift < 35; shift += 7) {
+    int byte = fgetc(file);
+    if (byte == EOF) return false;
+    result |= (uint32_t)(byte & 0x7F) << shift;
+    if ((byte & 0x80) == 0) {
+      *value = result;
+      return true;
+    }
+  }
+  // Too many bytes for a uint32.
+  return false;
+}
+
+Recording::Recording()
+{
+  seed_ = 0;
+  ticksPerSecond_ = 0;
+  numGhosts_ = 0;
+  levelHash_ = 0;
+  numTicks_ = 0;
+  runDirections_ = NULL;
+  runLengths_ = NULL;
+  numRuns_ = 0;
+  capacity_ = 0;
+  playRun_ = 0;
+  playTick_ = 0;
+}
+
+Recording::~Recording()
+{
+  if (runDirections_ != NULL) free(runDirections_);
+  if (runLengths_ != NULL) free(runLengths_);
+}
+
+void Recording::start(uint32_t seed, int ticksPerSecond, int numGhosts, uint32_t levelHash)
+{
+  seed_ = seed;
+  ticksPerSecond_ = ticksPerSecond;
+  numGhosts_ = numGhosts;
+  levelHash_ = levelHash;
+  numTicks_ = 0;
+  numRuns_ = 0;
+  rewind();
+}
+
+bool Recording::reserve(int numRuns)
+{
+  if (numRuns <= capacity_) return true;
+  int capacity = (capacity_ == 0) ? 256 : capacity_;
+  while (capacity < numRuns) capacity *= 2;
+
+  uint8_t *directions = (uint8_t *)realloc(runDirections_, capacity * sizeof(uint8_t));
+  if (directions == NULL) {
+    printf("Failed to allocate memory for recording!\n");
+    return false;
+  }
+  runDirections_ = directions;
+  uint32_t *lengths = (uint32_t *)realloc(runLengths_, capacity * sizeof(uint32_t));
+  if (lengths == NULL) {
+    printf("Failed to allocate memory for recording!\n");
+    return false;
+  }
+  runLengths_ = lengths;
+  capacity_ = capacity;
+  return true;
+}
+
+bool Recording::addTick(Direction direction)
+{
+  if (numRuns_ > 0 && runDirections_[numRuns_ - 1] == direction &&
+      runLengths_[numRuns_ - 1] < UINT32_MAX) {
+    // Same as last tick, so lengthen the current run.
+    runLengths_[numRuns_ - 1]++;
+  } else {
+    // Otherwise start a new one.
+    if (!reserve(numRuns_ + 1)) return false;
+    runDirections_[numRuns_] = (uint8_t)direction;
+    runLengths_[numRuns_] = 1;
+    numRuns_++;
+  }
+  numTicks_++;
+  return true;
+}
+
+bool Recording::save(const char *path)
+{
+  FILE *file = fopen(path, "wb");
+  if (file == NULL) {
+    printf("Unable to open recording '%s' for writing!\n", path);
+    return false;
+  }
+
+  fwrite(MAGIC, 1, sizeof(MAGIC), file);
+  writeU16(file, VERSION);
+  writeU16(file, (uint16_t)ticksPerSecond_);
+  writeU32(file, seed_);
+  writeU32(file, (uint32_t)numGhosts_);
+  writeU32(file, levelHash_);
+  writeU32(file, (uint32_t)numTicks_);
+  writeU32(file, (uint32_t)numRuns_);
+  for (int i = 0; i < numRuns_; i++) {
+    fputc(runDirections_[i], file);
+    writeVarint(file, runLengths_[i]);
+  }
+
+  bool success = !ferror(file);
+  if (fclose(file) != 0) success = false;
+  if (!success) printf("Failed to write recording '%s'!\n", path);
+  return success;
+}
+
+bool Recording::load(const char *path)
+{
+  FILE *file = fopen(path, "rb");
+  if (file == NULL) {
+    printf("Unable to open recording '%s'!\n", path);
+    return false;
+  }
+
+  bool success = true;
+  char magic[4];
+  uint16_t version = 0;
+  uint16_t ticksPerSecond = 0;
+  uint32_t seed = 0;
+  uint32_t numGhosts = 0;
+  uint32_t levelHash = 0;
+  uint32_t numTicks = 0;
+  uint32_t numRuns = 0;
+  if (fread(magic, 1, sizeof(magic), file) != sizeof(magic) ||
+      memcmp(magic, MAGIC, sizeof(MAGIC)) != 0) {
+    printf("'%s' is not a recording!\n", path);
+    success = false;
+  } else if (!readU16(file, &version) || version != VERSION) {
+    printf("Recording '%s' is version %d, expected version %d!\n", path, version, VERSION);
+    success = false;
+  } else if (!readU16(file, &ticksPerSecond) || !readU32(file, &seed) ||
+             !readU32(file, &numGhosts) || !readU32(file, &levelHash) ||
+             !readU32(file, &numTicks) || !readU32(file, &numRuns)) {
+    printf("Recording '%s' is truncated!\n", path);
+    success = false;
+  } else if (ticksPerSecond == 0 || numGhosts == 0 || numGhosts > INT32_MAX ||
+             numRuns > numTicks || numTicks > INT32_MAX) {
+    printf("Recording '%s' is corrupt!\n", path);
+    success = false;
+  }
+
+  if (success) {
+    start(seed, ticksPerSecond, (int)numGhosts, levelHash);
+    success = reserve((int)numRuns);
+  }
+
+  uint64_t totalTicks = 0;
+  for (uint32_t i = 0; success && i < numRuns; i++) {
+    int direction = fgetc(file);
+    uint32_t length = 0;
+    if (direction == EOF || !readVarint(file, &length)) {
+      printf("Recording '%s' is truncated!\n", path);
+      success = false;
+    } else if (direction > DIRECTION_RIGHT || length == 0) {
+      printf("Recording '%s' is corrupt!\n", path);
+      success = false;
+    } else {
+      runDirections_[i] = (uint8_t)direction;
+      runLengths_[i] = length;
+      totalTicks += length;
+    }
+  }
+  if (success && totalTicks != numTicks) {
+    printf("Recording '%s' is corrupt!\n", path);
+    success = false;
+  }
+
+  if (success) {
+    numRuns_ = (int)numRuns;
+    numTicks_ = (int)numTicks;
+  } else {
+    start(0, 0, 0, 0);
+  }
+  fclose(file);
+  return success;
+}
+
+uint32_t Recording::getSeed()
+{
+  return seed_;
+}
+
+int Recording::getTicksPerSecond()
+{
+  return ticksPerSecond_;
+}
+
+int Recording::getNumGhosts()
+{
+  return numGhosts_;
+}
+
+uint32_t Recording::getLevelHash()
+{
+  return levelHash_;
+}
+
+int Recording::getNumTicks()
+{
+  return numTicks_;
+}
+
+int Recording::getNumRuns()
+{
+  return numRuns_;
+}
+
+void Recording::rewind()
+{
+  playRun_ = 0;
+  playTick_ = 0;
+}
+
+Direction Recording::nextDirection()
+{
+  if (isFinished()) return DIRECTION_NONE;
+  Direction direction = (Direction)runDirections_[playRun_];
+  playTick_++;
+  if (playTick_ == runLengths_[playRun_]) {
+    playRun_++;
+    playTick_ = 0;
+  }
+  return direction;
+}
+
+bool Recording::isFinished()
+{
+  return playRun_ >= numRuns_;
+}
@@ -0,0 +1,96 @@
+#ifndef recording_h
+#define recording_h
+
+#include <stdint.h>
+#include "direction.h"
+
+/**
+ * Everything needed to play a session again exactly: the seed, tick rate
+ * and number of ghosts the simulation was created with, which level it
+ * was played on, and the direction passed to Simulation::update() on
+ * every tick. The level itself isn't kept, only its hash, so that
+ * replaying on any other level can be refused.
+ *
+ * Directions are stored as runs of the same direction, as the player
+ * mostly holds a direction or inputs nothing for many ticks at a time.
+ *
+ * File format, all integers little-endian:
+ *
+ *   "PMRC"             magic
+ *   uint16             version (3)
+ *   uint16             ticks per second
+ *   uint32             seed
+ *   uint32             number of ghosts
+ *   uint32             hash of the level, see Level::getHash()
+ *   uint32             number of ticks
+ *   uint32             number of runs
+ *   runs               one byte direction, then the run length as an
+ *                      unsigned LEB128 varint
+ */
+class Recording {
+  public:
+    Recording();
+    ~Recording();
+    
+    // Forget any ticks, and start a recording of a new session.
+    void start(uint32_t seed, int ticksPerSecond, int numGhosts, uint32_t levelHash);
+    
+    /**
+     * Append the direction passed to update() on the next tick.
+     * \Returns false if unable to allocate space for it.
+     */
+    bool addTick(Direction direction);
+    
+    // \Returns false on failure to write or read the file.
+    bool save(const char *path);
+    bool load(const char *path);
+    
+    uint32_t getSeed();
+    int getTicksPerSecond();
+    int getNumGhosts();
+    uint32_t getLevelHash();
+    int getNumTicks();
+    int getNumRuns();
+    
+    /**
+     * For playing back: the direction of each tick in order, starting
+     * again from the first tick after rewind(). Returns DIRECTION_NONE
+     * once past the last tick.
+     */
+    void rewind();
+    Direction nextDirection();
+    bool isFinished();
+    
+  private:
+    // Make room for at least numRuns runs.
+    bool reserve(int numRuns);
+    
+    uint32_t seed_;
+    int ticksPerSecond_;
+    int numGhosts_;
+    uint32_t levelHash_;
+    int numTicks_;
+    
+    // Run i is runLengths_[i] ticks of runDirections_[i].
+    uint8_t *runDirections_;
+    uint32_t *runLengths_;
+    int numRuns_;
+    int capacity_;
+    
+    // Where playback is up to.
+    int playRun_;
+    uint32_t playTick_;
+    
+    /**
+     * Only the inputs are recorded, so the same recording plays out
+     * differently once the rules of the game change. Go up by one whenever
+     * they do, or the format does, so old recordings are refused rather
+     * than replayed wrongly.
+     *
+     * 2: movement in fixed-point sub-pixels, and ghost targeting policies.
+     * 3: the number of ghosts and the level's hash.
+     */
+    static const uint16_t VERSION = 3;
+};
+
+#endif /* recording_h */
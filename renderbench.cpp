@@ -0,0 +1,387 @@
+// renderbench: micro and macrobenchmarks for drawing the game, with no
+// window on screen. SDL's dummy video driver and software renderer make
+// a null renderer: everything is drawn, into memory, and never shown, so
+// timings don't depend on a GPU, a display or vsync. The same frames are
+// also timed drawn by Rasterizer, on one thread and on every core.
+//
+// Build and run with:
+//   cmake --build build --target renderbench
+//   ./build/renderbench
+//
+// Takes the same --json, --label and --replay options as bench, and
+// --dirty-rects to draw frames as the game does with that option.
+//
+// With --check-allocations, instead draws scripted games frame by frame,
+// and fails if drawing ever allocates (see allocations.h). With
+// --check-rasterizer, draws frames of scripted games both with the
+// software renderer and with Rasterizer, and fails if they differ.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include "allocations.h"
+#include "benchmark.h"
+#include "game.h"
+#include "level.h"
+#include "rasterizer.h"
+#include "recording.h"
+#include "threadpool.h"
+
+// Ticks to step the game before timing each frame, so there are eaten
+// pellets to skip and ghosts out of the base to draw.
+static const int WARM_UP_TICKS = 300;
+
+/**
+ * For calling the parts of Game that draw a frame one at a time, with
+ * the simulation stepped by hand rather than on its own thread.
+ * A friend of Game, so keep to calling through, no logic.
+ */
+class GameBench {
+  public:
+    // Step the simulation by one tick, and take a snapshot of it to draw.
+    static void step(Game *game, Direction direction)
+    {
+      game->simulation_->update(direction);
+      game->publishSnapshot();
+      game->snapshots_.update();
+      game->snapshot_ = game->snapshots_.getFront();
+    }
+
+    static const Snapshot *getSnapshot(Game *game)
+    {
+      return game->snapshot_;
+    }
+
+    static bool isGameOver(Game *game)
+    {
+      return game->simulation_->isGameOver();
+    }
+
+    // Draw every wall of the maze with drawWall(), and flush them.
+    static int drawWalls(Game *game)
+    {
+      int numWalls = 0;
+      for (int y = 0; y < game->boardHeight_; y++) {
+        for (int x = 0; x < game->boardWidth_; x++) {
+          WallSprite sprite = game->wallSprites_[(y * game->boardWidth_) + x];
+          if (sprite == WALL_NONE || sprite == WALL_GATE) continue;
+          game->drawWall(x * Game::TILE_SIZE, y * Game::TILE_SIZE, sprite);
+          numWalls++;
+        }
+      }
+      game->flushSprites();
+      return numWalls;
+    }
+
+    static void drawScene(Game *game)
+    {
+      game->drawScene(NULL);
+    }
+
+    static void render(Game *game)
+    {
+      game->render();
+    }
+
+    static void present(Game *game)
+    {
+      SDL_RenderPresent(game->renderer_);
+    }
+
+    // Read back the frame drawn so far, before it is presented.
+    static bool readPixels(Game *game, uint32_t *pixels, int pitch)
+    {
+      return SDL_RenderReadPixels(game->renderer_, NULL, SDL_PIXELFORMAT_RGBA8888,
+                                  pixels, pitch) == 0;
+    }
+};
+
+// Walls drawn by the last call of benchDrawWalls.
+static int numWalls;
+
+static void benchDrawWalls(void *arg)
+{
+  numWalls = GameBench::drawWalls((Game *)arg);
+}
+
+// Maze, the loop over every tile for pellets, and actors, for the whole screen.
+static void benchDrawScene(void *arg)
+{
+  GameBench::drawScene((Game *)arg);
+}
+
+// A whole frame as the game draws it, dirty rects and all, of the same tick.
+static void benchRender(void *arg)
+{
+  GameBench::render((Game *)arg);
+}
+
+// A frame drawn by Rasterizer, and the pool to spread it over, if any.
+struct RasterizerFrame {
+  Rasterizer *rasterizer;
+  const Snapshot *snapshot;
+  ThreadPool *pool;
+};
+
+static void benchRasterize(void *arg)
+{
+  RasterizerFrame *frame = (RasterizerFrame *)arg;
+  frame->rasterizer->render(frame->snapshot, frame->pool);
+}
+
+/**
+ * Step game through every tick of a game, drawing and presenting a frame
+ * per tick, with directions from recording, or from a script if NULL.
+ * \Returns nanoseconds per tick, or 0 if no ticks were played.
+ */
+static double timeFrames(Game *game, Recording *recording)
+{
+  typedef std::chrono::steady_clock Clock;
+  int ticks = 0;
+  Clock::time_point start = Clock::now();
+  while (recording != NULL ? !recording->isFinished() : !GameBench::isGameOver(game) && ticks < 10000) {
+    Direction direction = (recording != NULL) ? recording->nextDirection() : getScriptedDirection(1, ticks);
+    GameBench::step(game, direction);
+    GameBench::render(game);
+    GameBench::present(game);
+    ticks++;
+  }
+  double elapsedNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+  return (ticks > 0) ? elapsedNs / ticks : 0;
+}
+
+/**
+ * Play scripted games through Game, stepping, drawing and presenting a
+ * frame per tick, with and without dirty rects, and drawing each tick
+ * with Rasterizer too, counting the heap allocations made after the
+ * first frame.
+ * \Returns false if there were any.
+ */
+static bool checkAllocations(GameOptions options)
+{
+  static const int NUM_SCRIPTS = 4;
+  Level level;
+  Rasterizer rasterizer;
+  if (!level.getSuccess() || !rasterizer.init(&level, options.numGhosts)) {
+    return false;
+  }
+  int frames = 0;
+  unsigned long allocations = 0;
+  for (int script = 1; script <= NUM_SCRIPTS; script++) {
+    options.seed = script;
+    options.useDirtyRects = (script % 2 == 0);
+    Game *game = new Game(options);
+    if (!game->getSuccess()) {
+      printf("Game initialisation failed!\n");
+      delete game;
+      return false;
+    }
+    // The first frame is left out, as it sets everything up.
+    GameBench::step(game, getScriptedDirection(script, 0));
+    GameBench::render(game);
+    GameBench::present(game);
+    unsigned long allocationsBefore = getNumAllocations();
+    for (int tick = 1; !GameBench::isGameOver(game) && tick < 10000; tick++) {
+      GameBench::step(game, getScriptedDirection(script, tick));
+      GameBench::render(game);
+      GameBench::present(game);
+      rasterizer.render(GameBench::getSnapshot(game));
+      frames++;
+    }
+    allocations += getNumAllocations() - allocationsBefore;
+    delete game;
+  }
+  printf("%lu heap allocations over %d frames of %d games.\n", allocations, frames, NUM_SCRIPTS);
+  return allocations == 0;
+}
+
+/**
+ * Play scripted games through Game, with and without dirty rects, and
+ * every so many ticks draw the frame both as the game does and with
+ * Rasterizer, comparing the two pixel by pixel. Alpha is left out, as
+ * the window's own alpha depends on the video driver.
+ * \Returns false if any pixel differs.
+ */
+static bool checkRasterizer(GameOptions options)
+{
+  static const int NUM_SCRIPTS = 4;
+  static const int TICKS_BETWEEN_CHECKS = 50;
+  Level level;
+  Rasterizer rasterizer;
+  if (!level.getSuccess() || !rasterizer.init(&level, options.numGhosts)) {
+    return false;
+  }
+  int width = rasterizer.getWidth();
+  int height = rasterizer.getHeight();
+  uint32_t *pixels = (uint32_t *)malloc(width * height * sizeof(uint32_t));
+  if (pixels == NULL) {
+    printf("Failed to allocate memory for frame!\n");
+    return false;
+  }
+
+  bool success = true;
+  int numFrames = 0;
+  long numDifferent = 0;
+  for (int script = 1; success && script <= NUM_SCRIPTS; script++) {
+    options.seed = script;
+    options.useDirtyRects = (script % 2 == 0);
+    Game *game = new Game(options);
+    if (!game->getSuccess()) {
+      printf("Game initialisation failed!\n");
+      delete game;
+      success = false;
+      break;
+    }
+    bool isLastFrame = false;
+    for (int tick = 0; !isLastFrame && tick < 10000; tick++) {
+      GameBench::step(game, getScriptedDirection(script, tick));
+      GameBench::render(game);
+      isLastFrame = GameBench::isGameOver(game);
+      if (tick % TICKS_BETWEEN_CHECKS == 0 || isLastFrame) {
+        if (!GameBench::readPixels(game, pixels, width * sizeof(uint32_t))) {
+          printf("Unable to read back frame! %s\n", SDL_GetError());
+          success = false;
+          break;
+        }
+        rasterizer.render(GameBench::getSnapshot(game));
+        const uint32_t *expected = rasterizer.getPixels();
+        for (int i = 0; i < width * height; i++) {
+          if ((pixels[i] ^ expected[i]) & 0xFFFFFF00) {
+            if (numDifferent == 0) {
+              printf("Game %d, tick %d: pixel (%d, %d) is %08x, Rasterizer drew %08x.\n",
+                     script, tick, i % width, i / width, pixels[i], expected[i]);
+            }
+            numDifferent++;
+          }
+        }
+        numFrames++;
+      }
+      GameBench::present(game);
+    }
+    delete game;
+  }
+  free(pixels);
+  if (success) {
+    printf("%ld pixels differed over %d frames of %d games.\n", numDifferent, numFrames, NUM_SCRIPTS);
+  }
+  return success && numDifferent == 0;
+}
+
+static void printUsage(const char *program)
+{
+  printf("Usage: %s [--json] [--label build] [--dirty-rects] [--replay file.rec]...\n"
+         "       %s --check-allocations\n"
+         "       %s --check-rasterizer\n", program, program, program);
+}
+
+int main(int argc, char *argv[])
+{
+  // Read command line options.
+  GameOptions options;
+  options.useSoftwareRenderer = true;
+  options.seed = 1;
+  const char **replayPaths = (const char **)malloc(argc * sizeof(const char *));
+  int numReplays = 0;
+  bool isCheckingAllocations = false;
+  bool isCheckingRasterizer = false;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--check-allocations") == 0 && argc == 2) {
+      isCheckingAllocations = true;
+    } else if (strcmp(argv[i], "--check-rasterizer") == 0 && argc == 2) {
+      isCheckingRasterizer = true;
+    } else if (strcmp(argv[i], "--json") == 0) {
+      setJsonOutput(true);
+    } else if (strcmp(argv[i], "--label") == 0 && i + 1 < argc) {
+      setBuildLabel(argv[++i]);
+    } else if (strcmp(argv[i], "--dirty-rects") == 0) {
+      options.useDirtyRects = true;
+    } else if (strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+      replayPaths[numReplays++] = argv[++i];
+    } else {
+      printUsage(argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Draw into memory, with no window on screen, unless asked otherwise.
+  SDL_setenv("SDL_VIDEODRIVER", "dummy", 0);
+
+  if (isCheckingAllocations) {
+    free(replayPaths);
+    return checkAllocations(options) ? EXIT_SUCCESS : EXIT_FAILURE;
+  }
+  if (isCheckingRasterizer) {
+    free(replayPaths);
+    return checkRasterizer(options) ? EXIT_SUCCESS : EXIT_FAILURE;
+  }
+
+  /* Microbenchmarks. */
+
+  Game *game = new Game(options);
+  if (!game->getSuccess()) {
+    printf("Game initialisation failed!\n");
+    return EXIT_FAILURE;
+  }
+  for (int tick = 0; tick < WARM_UP_TICKS; tick++) {
+    GameBench::step(game, getScriptedDirection(1, tick));
+  }
+
+  reportHeading("Drawing one tick of a game, %d ticks in, with the %s video driver.",
+                WARM_UP_TICKS, SDL_GetCurrentVideoDriver());
+  double wallsNs = timeNsPerOp(benchDrawWalls, game);
+  report("draw/drawWall per wall", wallsNs / numWalls);
+  report("draw/scene", timeNsPerOp(benchDrawScene, game));
+  report("draw/render", timeNsPerOp(benchRender, game));
+  
+  Level level;
+  Rasterizer rasterizer;
+  if (!level.getSuccess() || !rasterizer.init(&level, options.numGhosts)) {
+    return EXIT_FAILURE;
+  }
+  ThreadPool pool;
+  RasterizerFrame frame = { &rasterizer, GameBench::getSnapshot(game), NULL };
+  report("rasterizer/render", timeNsPerOp(benchRasterize, &frame));
+  frame.pool = &pool;
+  char name[64];
+  snprintf(name, sizeof(name), "rasterizer/render banded, %d threads", pool.getNumThreads());
+  report(name, timeNsPerOp(benchRasterize, &frame));
+  delete game;
+
+  /* Macrobenchmarks. */
+
+  reportHeading("Whole games, stepping, drawing and presenting a frame per tick.");
+  game = new Game(options);
+  if (!game->getSuccess()) {
+    printf("Game initialisation failed!\n");
+    return EXIT_FAILURE;
+  }
+  reportTicks("frame/game per tick", timeFrames(game, NULL));
+  delete game;
+
+  for (int i = 0; i < numReplays; i++) {
+    Recording recording;
+    if (!recording.load(replayPaths[i])) {
+      return EXIT_FAILURE;
+    }
+    Level level;
+    if (recording.getLevelHash() != level.getHash()) {
+      printf("Recording '%s' wasn't played on the default level!\n", replayPaths[i]);
+      return EXIT_FAILURE;
+    }
+    options.seed = recording.getSeed();
+    options.simulationRate = recording.getTicksPerSecond();
+    options.numGhosts = recording.getNumGhosts();
+    game = new Game(options);
+    if (!game->getSuccess()) {
+      printf("Game initialisation failed!\n");
+      return EXIT_FAILURE;
+    }
+    snprintf(name, sizeof(name), "frame/%s per tick", replayPaths[i]);
+    reportTicks(name, timeFrames(game, &recording));
+    delete game;
+  }
+
+  free(replayPaths);
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,93 @@
+#ifndef scene_h
+#define scene_h
+
+#include "level.h"
+#include "simulation.h"
+#include "snapshot.h"
+#include "sprites.h"
+#include "tile.h"
+#include "wall.h"
+
+/**
+ * Which sprite from the atlas each part of a snapshot is drawn with, so
+ * Game (through SDL) and Rasterizer (into memory) draw the same scene.
+ * NUM_SPRITES is returned for anything that isn't drawn.
+ */
+
+inline SpriteId getWallSpriteId(WallSprite sprite)
+{
+  static const SpriteId WALL_SPRITE_IDS[] = {
+    NUM_SPRITES,
+    SPRITE_WALL_TOP_LEFT, SPRITE_WALL_TOP_RIGHT,
+    SPRITE_WALL_BOT_LEFT, SPRITE_WALL_BOT_RIGHT,
+    SPRITE_WALL_LEFT_RIGHT, SPRITE_WALL_TOP_BOT,
+    SPRITE_GATE
+  };
+  return WALL_SPRITE_IDS[sprite];
+}
+
+inline SpriteId getPelletSprite(TileType tile, int pelletAnimationFrame)
+{
+  if (tile == TILE_PELLET) {
+    return SPRITE_PELLET;
+  } else if (tile == TILE_POWER_PELLET) {
+    return (pelletAnimationFrame == 1) ? SPRITE_POWER_PELLET_1 : SPRITE_POWER_PELLET_0;
+  }
+  return NUM_SPRITES;
+}
+
+inline SpriteId getPacmanSprite(const Snapshot &snapshot)
+{
+  // Already turned to face each way, by animation frame and Direction.
+  static const SpriteId PACMAN_SPRITES[2][5] = {
+    { SPRITE_PACMAN_STILL, SPRITE_PACMAN_UP_0, SPRITE_PACMAN_DOWN_0, SPRITE_PACMAN_LEFT_0, SPRITE_PACMAN_RIGHT_0 },
+    { SPRITE_PACMAN_STILL, SPRITE_PACMAN_UP_1, SPRITE_PACMAN_DOWN_1, SPRITE_PACMAN_LEFT_1, SPRITE_PACMAN_RIGHT_1 },
+  };
+  int frame = (snapshot.pacmanAnimationFrame == 1) ? 1 : 0;
+  return PACMAN_SPRITES[frame][snapshot.pacman.direction];
+}
+
+// Each ghost is drawn as whichever ghost it acts like.
+inline LevelActorIndex getGhostLook(int i)
+{
+  return (LevelActorIndex)(LEVEL_BLINKY + (i % Simulation::NUM_PERSONALITIES));
+}
+
+// The body of ghost i. Eaten ghosts are just eyes.
+inline SpriteId getGhostSprite(const Snapshot &snapshot, int i)
+{
+  const ActorSnapshot &ghost = snapshot.ghosts[i];
+  if (ghost.state == GHOST_FRIGHTENED) {
+    // Flashing white as power runs out.
+    return snapshot.isFrightenedFlashing ? SPRITE_GHOST_FRIGHTENED_FLASH : SPRITE_GHOST_FRIGHTENED;
+  } else if (ghost.state == GHOST_EATEN) {
+    return NUM_SPRITES;
+  }
+  static const SpriteId GHOST_SPRITES[NUM_LEVEL_ACTORS] = {
+    NUM_SPRITES, SPRITE_GHOST_BLINKY, SPRITE_GHOST_INKY, SPRITE_GHOST_PINKY, SPRITE_GHOST_CLYDE
+  };
+  return GHOST_SPRITES[getGhostLook(i)];
+}
+
+// Marks ghost i's target tile, for debugging.
+inline SpriteId getGhostTargetSprite(int i)
+{
+  static const SpriteId TARGET_SPRITES[NUM_LEVEL_ACTORS] = {
+    NUM_SPRITES, SPRITE_TARGET_BLINKY, SPRITE_TARGET_INKY, SPRITE_TARGET_PINKY, SPRITE_TARGET_CLYDE
+  };
+  return TARGET_SPRITES[getGhostLook(i)];
+}
+
+// Eyes looking the way the ghost is going. Frightened ghosts have none.
+inline SpriteId getGhostEyesSprite(const ActorSnapshot &ghost)
+{
+  if (ghost.state == GHOST_FRIGHTENED) {
+    return NUM_SPRITES;
+  }
+  static const SpriteId EYES_SPRITES[5] = {
+    SPRITE_EYES_DOWN, SPRITE_EYES_UP, SPRITE_EYES_DOWN, SPRITE_EYES_LEFT, SPRITE_EYES_RIGHT
+  };
+  return EYES_SPRITES[ghost.direction];
+}
+
+#endif /* scene_h */
@@ -0,0 +1,340 @@
+// pacman-sim: plays many headless games on every core, with PACMAN steered
+// by one of the built-in policies, and writes one line of JSON per game.
+//
+// Build with:
+//   cmake --build build --target pacman-sim
+//
+// For example, 10000 games of the greedy policy, at most 5 minutes each:
+//   ./build/pacman-sim --seeds 1-10000 --ticks 18000 --policy greedy > results.jsonl
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include "level.h"
+#include "random.h"
+#include "simulation.h"
+#include "threadpool.h"
+#include "tileexits.h"
+
+typedef enum {
+  POLICY_RANDOM,   // Wander, turning at random at every junction.
+  POLICY_GREEDY    // Head for the nearest pellet, keeping clear of ghosts.
+} Policy;
+
+static const char *POLICY_NAMES[2] = { "random", "greedy" };
+
+// How one game ended.
+struct GameResult {
+  int ticks;
+  int pellets;
+  bool isGameOver;
+  bool isGameOverWin;
+  bool isFailed;    // The simulation failed to initialise.
+};
+
+// Everything the games of one run share.
+struct Run {
+  uint32_t firstSeed;
+  int maxTicks;
+  int ticksPerSecond;
+  int numGhosts;
+  Policy policy;
+  Level *level;          // Only read, so shared by every game.
+  GameResult *results;   // One per seed.
+  // Scratch space for the greedy policy's searches, one per thread.
+  int **firstSteps;
+  int **queues;
+};
+
+static const Direction DIRECTIONS[4] = {
+  DIRECTION_UP, DIRECTION_DOWN, DIRECTION_LEFT, DIRECTION_RIGHT
+};
+static const int DX[5] = { 0, 0, 0, -1, 1 };
+static const int DY[5] = { 0, -1, 1, 0, 0 };
+
+// Can PACMAN walk into this tile?
+static bool isOpen(Simulation *simulation, int tileX, int tileY)
+{
+  TileType tile = simulation->getTile(tileX, tileY);
+  return tile != TILE_WALL && tile != TILE_GATE && tile != TILE_BASE;
+}
+
+/**
+ * Pick at random one of the ways out of the tile PACMAN is exactly in,
+ * not turning back unless it is the only way.
+ */
+static Direction chooseRandom(Simulation *simulation, Random *random, int tileX, int tileY)
+{
+  Actor *pacman = simulation->getPacman();
+  Direction reverse = getOppositeDirection(pacman->getDirection());
+  Direction choices[4];
+  int numChoices = 0;
+  for (int i = 0; i < 4; i++) {
+    Direction direction = DIRECTIONS[i];
+    if (direction != reverse && isOpen(simulation, tileX + DX[direction], tileY + DY[direction])) {
+      choices[numChoices++] = direction;
+    }
+  }
+  if (numChoices == 0) return reverse;
+  return choices[random->nextInt(numChoices)];
+}
+
+/**
+ * Breadth first search out of the tile PACMAN is exactly in, for the
+ * nearest pellet. Tiles with ghosts PACMAN can't eat in them, and tiles
+ * next to those, are treated as walls.
+ * \Returns direction of the first step there, or DIRECTION_NONE if no
+ * pellet can be reached.
+ */
+static Direction chooseGreedy(Simulation *simulation, int tileX, int tileY,
+                              int *firstSteps, int *queue)
+{
+  int width = simulation->getBoardWidth();
+  int height = simulation->getBoardHeight();
+  // First step taken to reach each tile, or -1 if not reached yet.
+  for (int i = 0; i < width * height; i++) firstSteps[i] = -1;
+
+  // Mark the tiles around dangerous ghosts as already reached.
+  Actor *pacman = simulation->getPacman();
+  for (int i = 0; i < simulation->getNumGhosts(); i++) {
+    Actor *ghost = simulation->getGhost(i);
+    GHOST_STATE state = ghost->getState();
+    if (state == GHOST_EATEN || (state == GHOST_FRIGHTENED && pacman->getPower() > 0)) continue;
+    int ghostTileX = (ghost->getX() + (Simulation::TILE_SIZE / 2)) / Simulation::TILE_SIZE;
+    int ghostTileY = (ghost->getY() + (Simulation::TILE_SIZE / 2)) / Simulation::TILE_SIZE;
+    for (int d = 0; d < 5; d++) {
+      int x = ghostTileX + DX[d];
+      int y = ghostTileY + DY[d];
+      if (x >= 0 && x < width && y >= 0 && y < height) {
+        firstSteps[(y * width) + x] = DIRECTION_NONE;
+      }
+    }
+  }
+
+  int head = 0;
+  int tail = 0;
+  firstSteps[(tileY * width) + tileX] = DIRECTION_NONE;
+  queue[tail++] = (tileY * width) + tileX;
+  while (head < tail) {
+    int tile = queue[head++];
+    int x = tile % width;
+    int y = tile / width;
+    TileType type = simulation->getTile(x, y);
+    if (head > 1 && (type == TILE_PELLET || type == TILE_POWER_PELLET)) {
+      return (Direction)firstSteps[tile];
+    }
+    for (int i = 0; i < 4; i++) {
+      Direction direction = DIRECTIONS[i];
+      int nextX = x + DX[direction];
+      int nextY = y + DY[direction];
+      if (!isOpen(simulation, nextX, nextY)) continue;
+      int next = (nextY * width) + nextX;
+      if (firstSteps[next] != -1) continue;
+      firstSteps[next] = (head == 1) ? direction : firstSteps[tile];
+      queue[tail++] = next;
+    }
+  }
+  return DIRECTION_NONE;
+}
+
+// Play the game with seed firstSeed + index to the end, or to the tick cap.
+static void playGame(void *arg, int index, int thread)
+{
+  Run *run = (Run *)arg;
+  uint32_t seed = run->firstSeed + (uint32_t)index;
+  GameResult *result = &run->results[index];
+  result->ticks = 0;
+  result->pellets = 0;
+  result->isGameOver = false;
+  result->isGameOverWin = false;
+  result->isFailed = false;
+
+  Simulation *simulation = new Simulation(run->ticksPerSecond, seed, run->level, run->numGhosts);
+  if (!simulation->getSuccess()) {
+    result->isFailed = true;
+    delete simulation;
+    return;
+  }
+  // The policy draws its own random numbers, so as not to
+  // change the choices frightened ghosts make.
+  Random random(~seed);
+  Actor *pacman = simulation->getPacman();
+
+  int tick = 0;
+  for (; tick < run->maxTicks && !simulation->isGameOver(); tick++) {
+    Direction direction = pacman->getDirection();
+    int tileSize = Simulation::TILE_SIZE;
+    int tileX = pacman->getX() / tileSize;
+    int tileY = pacman->getY() / tileSize;
+    if (direction == DIRECTION_NONE) {
+      // Still at the start, between two tiles.
+      direction = (random.nextInt(2) == 0) ? DIRECTION_LEFT : DIRECTION_RIGHT;
+    } else if (pacman->isAt(tileX * tileSize, tileY * tileSize)) {
+      // Exactly in a tile, so free to turn.
+      Direction choice = DIRECTION_NONE;
+      if (run->policy == POLICY_GREEDY) {
+        choice = chooseGreedy(simulation, tileX, tileY,
+                              run->firstSteps[thread], run->queues[thread]);
+      }
+      if (choice == DIRECTION_NONE) choice = chooseRandom(simulation, &random, tileX, tileY);
+      direction = choice;
+    }
+    simulation->update(direction);
+  }
+
+  result->ticks = tick;
+  result->pellets = simulation->getPellets();
+  result->isGameOver = simulation->isGameOver();
+  result->isGameOverWin = simulation->isGameOverWin();
+  delete simulation;
+}
+
+static void printUsage(const char *program)
+{
+  printf("Usage: %s [--seeds first-last] [--ticks n] [--policy random|greedy]\n"
+         "          [--threads n] [--sim-rate hz] [--output file] [--level file.lvb]\n"
+         "          [--ghosts n]\n"
+         "Defaults to seeds 1-1000, 36000 ticks, the greedy policy, a thread per core,\n"
+         "the default level and 4 ghosts.\n",
+         program);
+}
+
+int main(int argc, char *argv[])
+{
+  Run run;
+  run.firstSeed = 1;
+  uint32_t lastSeed = 1000;
+  run.maxTicks = 10 * 60 * Simulation::DEFAULT_TICKS_PER_SECOND;
+  run.ticksPerSecond = Simulation::DEFAULT_TICKS_PER_SECOND;
+  run.numGhosts = Simulation::DEFAULT_NUM_GHOSTS;
+  run.policy = POLICY_GREEDY;
+  int numThreads = 0;
+  const char *outputPath = NULL;
+  const char *levelPath = NULL;
+
+  // Read command line options.
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--seeds") == 0 && i + 1 < argc) {
+      char *end;
+      run.firstSeed = (uint32_t)strtoul(argv[++i], &end, 10);
+      lastSeed = (*end == '-') ? (uint32_t)strtoul(end + 1, NULL, 10) : run.firstSeed;
+    } else if (strcmp(argv[i], "--ticks") == 0 && i + 1 < argc) {
+      run.maxTicks = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--policy") == 0 && i + 1 < argc) {
+      i++;
+      if (strcmp(argv[i], "random") == 0) {
+        run.policy = POLICY_RANDOM;
+      } else if (strcmp(argv[i], "greedy") == 0) {
+        run.policy = POLICY_GREEDY;
+      } else {
+        printUsage(argv[0]);
+        return EXIT_FAILURE;
+      }
+    } else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+      numThreads = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--sim-rate") == 0 && i + 1 < argc) {
+      run.ticksPerSecond = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--output") == 0 && i + 1 < argc) {
+      outputPath = argv[++i];
+    } else if (strcmp(argv[i], "--level") == 0 && i + 1 < argc) {
+      levelPath = argv[++i];
+    } else if (strcmp(argv[i], "--ghosts") == 0 && i + 1 < argc) {
+      run.numGhosts = atoi(argv[++i]);
+    } else {
+      printUsage(argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+  if (lastSeed < run.firstSeed || lastSeed - run.firstSeed >= 100000000 ||
+      run.maxTicks <= 0 || run.ticksPerSecond <= 0 || run.numGhosts <= 0) {
+    fprintf(stderr, "Seeds must be a range of at most 100000000, and ticks, rate and ghosts positive!\n");
+    return EXIT_FAILURE;
+  }
+  int numGames = (int)(lastSeed - run.firstSeed) + 1;
+
+  // Load the level once, rather than once per game.
+  run.level = new Level();
+  if (levelPath != NULL && !run.level->load(levelPath)) {
+    return EXIT_FAILURE;
+  }
+
+  FILE *output = stdout;
+  if (outputPath != NULL) {
+    output = fopen(outputPath, "w");
+    if (output == NULL) {
+      fprintf(stderr, "Unable to open '%s' for writing!\n", outputPath);
+      return EXIT_FAILURE;
+    }
+  }
+
+  ThreadPool *pool = new ThreadPool(numThreads);
+  numThreads = pool->getNumThreads();
+  int numTiles = run.level->getWidth() * run.level->getHeight();
+
+  bool success = true;
+  run.results = (GameResult *)malloc(numGames * sizeof(GameResult));
+  run.firstSteps = (int **)malloc(numThreads * sizeof(int *));
+  run.queues = (int **)malloc(numThreads * sizeof(int *));
+  if (run.results == NULL || run.firstSteps == NULL || run.queues == NULL) {
+    success = false;
+  } else {
+    for (int i = 0; i < numThreads; i++) {
+      run.firstSteps[i] = (int *)malloc(numTiles * sizeof(int));
+      run.queues[i] = (int *)malloc(numTiles * sizeof(int));
+      if (run.firstSteps[i] == NULL || run.queues[i] == NULL) success = false;
+    }
+  }
+  if (!success) {
+    fprintf(stderr, "Failed to allocate memory for %d games!\n", numGames);
+    return EXIT_FAILURE;
+  }
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  pool->run(numGames, playGame, &run);
+  double elapsedSeconds = std::chrono::duration<double>(
+    std::chrono::steady_clock::now() - start).count();
+
+  // One line per game, in seed order whichever thread played it.
+  long long totalTicks = 0;
+  int numWins = 0;
+  int numFailed = 0;
+  for (int i = 0; i < numGames; i++) {
+    GameResult *result = &run.results[i];
+    const char *outcome = "timeout";
+    if (result->isGameOver) outcome = result->isGameOverWin ? "win" : "loss";
+    if (result->isFailed) {
+      outcome = "error";
+      numFailed++;
+    }
+    fprintf(output, "{\"seed\":%u,\"policy\":\"%s\",\"result\":\"%s\",\"pellets\":%d,\"ticks\":%d}\n",
+            run.firstSeed + (uint32_t)i, POLICY_NAMES[run.policy], outcome,
+            result->pellets, result->ticks);
+    totalTicks += result->ticks;
+    if (result->isGameOverWin) numWins++;
+  }
+  if (output != stdout && fclose(output) != 0) {
+    fprintf(stderr, "Failed to write '%s'!\n", outputPath);
+    success = false;
+  }
+  if (numFailed > 0) {
+    fprintf(stderr, "%d games failed to initialise!\n", numFailed);
+    success = false;
+  }
+
+  // Summary on stderr, out of the way of the results.
+  fprintf(stderr, "%d games (%d won) on %d threads in %.2f s: %.0f games/s, %.0f ticks/s.\n",
+          numGames, numWins, numThreads, elapsedSeconds,
+          numGames / elapsedSeconds, totalTicks / elapsedSeconds);
+
+  for (int i = 0; i < numThreads; i++) {
+    free(run.firstSteps[i]);
+    free(run.queues[i]);
+  }
+  free(run.firstSteps);
+  free(run.queues);
+  free(run.results);
+  delete run.level;
+  delete pool;
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
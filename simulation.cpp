@@ -0,0 +1,1008 @@
+#include <stdio.h>
+#include <cassert>
+#include <cstdlib>
+#include "simulation.h"
+#include "level.h"
+#include "actor.h"
+#include "targeting.h"
+
+const int Simulation::MODE_SCHEDULE[NUM_MODES] = {
+  7, 20, // Wave 1. 7 seconds scatter, 20 seconds chase.
+  7, 20, // Wave 2. 7 seconds scatter, 20 seconds chase.
+  5, 20, // Wave 3. 5 seconds scatter, 20 seconds chase.
+  5, -1  // Endless Wave. 5 seconds scatter, endless chase.
+};
+
+const int Simulation::GHOST_SPEEDS[NUM_GHOST_STATES] = {
+  50,  // Waiting in the base.
+  75,  // Chase.
+  75,  // Scatter.
+  150, // Eaten, heading back to the base.
+  50,  // Frightened.
+  150, // Finding their spot in the base, still eaten.
+  50   // Finding the exit of the base.
+};
+
+Simulation::Simulation(int ticksPerSecond, uint32_t seed, Level *level, int numGhosts)
+{
+  ticksPerSecond_ = ticksPerSecond;
+  seed_ = seed;
+  random_.setSeed(seed);
+  pacman_ = NULL;
+  ghosts_ = NULL;
+  numGhosts_ = 0;
+  controlledGhost_ = -1;
+  ghostDirection_ = DIRECTION_NONE;
+  baseEntranceX_ = -1;
+  baseEntranceY_ = -1;
+  baseSpotX_ = -1;
+  baseSpotY_ = -1;
+  pellets_ = 0;
+  totalPellets_ = 0;
+  boardVersion_ = 0;
+  isGameOver_ = false;
+  isGameOverWin_ = false;
+  portalOneX = -1;
+  portalOneY = -1;
+  portalTwoX = -1;
+  portalTwoY = -1;
+  tunnelOneEndX_ = -1;
+  tunnelTwoEndX_ = -1;
+  modes_ = NULL;
+  currentModeIndex_ = 0;
+  isModeTimerRunning_ = false;
+  modeTicks_ = 0;
+  currentMode_ = false;
+  pacmanAnimationFrame_ = 0;
+  pacmanAnimationFrameCounter_ = 0;
+  pelletAnimationFrame_ = 0;
+  pelletAnimationFrameCounter_ = 0;
+  isFrightenedFlashing_ = false;
+
+  success_ = false;
+  
+  bool success = true;
+  
+  // Used by ghosts to find out how long to wait in current mode before switching.
+  if (success) {
+    modes_ = (int *)malloc(NUM_MODES * sizeof(int));
+    if (modes_ == NULL) {
+      printf("Failed to allocate memory for list of mode switching times!\n");
+      success = false;
+    }
+  }
+  if (success) {
+    for (int i = 0; i < NUM_MODES; i++) modes_[i] = MODE_SCHEDULE[i];
+  }
+  
+  // Speeds and timers are all worked out per tick.
+  if (ticksPerSecond < 1) {
+    printf("Need at least one tick per second, not %d!\n", ticksPerSecond);
+    success = false;
+  }
+
+  // List of ghosts, filled in once the level is read.
+  if (success && numGhosts < 1) {
+    printf("Need at least one ghost, not %d!\n", numGhosts);
+    success = false;
+  }
+  if (success) {
+    ghosts_ = (Actor **)malloc(numGhosts * sizeof(Actor *));
+    if (ghosts_ == NULL) {
+      printf("Failed to allocate memory for list of ghosts!\n");
+      success = false;
+    }
+  }
+  
+  // Play the given level, or the default level if none given.
+  Level *defaultLevel = NULL;
+  if (success && level == NULL) {
+    defaultLevel = new Level();
+    level = defaultLevel;
+  }
+  if (success && !level->getSuccess()) {
+    printf("No level to play!\n");
+    success = false;
+  }
+  
+  // Allocate space for game board.
+  if (success) {
+    boardHeight_ = level->getHeight();
+    boardWidth_ = level->getWidth();
+    if (!board_.init(boardWidth_, boardHeight_)) {
+      success = false;
+    }
+  }
+  if (success) {
+    if (!occupancy_.init(boardWidth_, boardHeight_, numGhosts)) {
+      success = false;
+    }
+  }
+  
+  // Copy in the game board. Everything else about the level was
+  // worked out when it was compiled, so needs no searching for.
+  if (success) {
+    for (int y = 0; y < boardHeight_; y++) {
+      for (int x = 0; x < boardWidth_; x++) {
+        board_.setTile(x, y, level->getTile(x, y));
+      }
+    }
+    totalPellets_ = level->getTotalPellets();
+    portalOneX = level->getPortalOneX();
+    portalOneY = level->getPortalOneY();
+    portalTwoX = level->getPortalTwoX();
+    portalTwoY = level->getPortalTwoY();
+    
+    // PACMAN, then each ghost as whichever of the level's ghosts it takes after.
+    for (int i = -1; i < numGhosts; i++) {
+      int index = (i == -1) ? LEVEL_PACMAN : LEVEL_BLINKY + (i % NUM_PERSONALITIES);
+      const LevelActor &start = level->getActor((LevelActorIndex)index);
+      Actor *actor = new Actor(start.startTileX, start.startTileY, TILE_SIZE,
+                               (Direction)start.direction, start.waitingPellets,
+                               start.spotTileX, start.spotTileY);
+      actor->setScatterTile(start.scatterTileX, start.scatterTileY);
+      if (i == -1) {
+        pacman_ = actor;
+      } else {
+        ghosts_[i] = actor;
+        numGhosts_++;
+        occupancy_.move(i, actor->getTileX(), actor->getTileY());
+      }
+    }
+    
+    // Every ghost finds the base by Blinky and Pinky, whether or not
+    // there are enough ghosts for there to be a Blinky or Pinky.
+    const LevelActor &blinky = level->getActor(LEVEL_BLINKY);
+    baseEntranceX_ = blinky.startTileX;
+    baseEntranceY_ = blinky.startTileY;
+    const LevelActor &pinky = level->getActor(LEVEL_PINKY);
+    baseSpotX_ = (pinky.spotTileX * TILE_SIZE) + (TILE_SIZE / 2);
+    baseSpotY_ = pinky.spotTileY * TILE_SIZE;
+  }
+  
+  // Free temp resource.
+  if (defaultLevel != NULL) delete defaultLevel;
+  
+  // The tunnels run from portal one on the left edge of the board, and
+  // portal two on the right edge, in to the first tile that isn't empty.
+  if (success && portalOneX != -1 && portalTwoX != -1) {
+    tunnelOneEndX_ = portalOneX;
+    while (board_.getTile(tunnelOneEndX_ + 1, portalOneY) == TILE_NONE) tunnelOneEndX_++;
+    tunnelTwoEndX_ = portalTwoX;
+    while (board_.getTile(tunnelTwoEndX_ - 1, portalTwoY) == TILE_NONE) tunnelTwoEndX_--;
+  }
+  
+  // Speeds are per second of game time, so work them out for this rate.
+  if (success) {
+    pacmanSpeed_ = percentToSpeed(PACMAN_SPEED);
+    pacmanPowerSpeed_ = percentToSpeed(PACMAN_POWER_SPEED);
+    ghostTunnelSpeed_ = percentToSpeed(GHOST_TUNNEL_SPEED);
+    for (int i = 0; i < NUM_GHOST_STATES; i++) {
+      ghostSpeeds_[i] = percentToSpeed(GHOST_SPEEDS[i]);
+    }
+  }
+  
+  // Compile the board into the exits ghosts steer by.
+  if (success) {
+    if (!tileExits_.init(&board_)) {
+      success = false;
+    }
+  }
+  
+  // Set to let caller know that initialisation succeeded.
+  success_ = success;
+  return;
+
+}
+
+Simulation::~Simulation()
+{
+  if (modes_ != NULL) free(modes_);
+  if (pacman_ != NULL) delete pacman_;
+  if (ghosts_ != NULL) {
+    for (int i = 0; i < numGhosts_; i++) delete ghosts_[i];
+    free(ghosts_);
+  }
+}
+
+bool Simulation::getSuccess()
+{
+  return success_;
+}
+
+int Simulation::getTicksPerSecond()
+{
+  return ticksPerSecond_;
+}
+
+uint32_t Simulation::getSeed()
+{
+  return seed_;
+}
+
+int Simulation::msToTicks(int ms)
+{
+  return (ms * ticksPerSecond_) / 1000;
+}
+
+int Simulation::percentToSpeed(int percent)
+{
+  return (FULL_SPEED * Actor::SUBPIXELS * percent) / (100 * ticksPerSecond_);
+}
+
+bool Simulation::isInTunnel(Actor *actor)
+{
+  if (tunnelOneEndX_ == -1 || actor->getTileY() != portalOneY) return false;
+  return actor->getTileX() <= tunnelOneEndX_ || actor->getTileX() >= tunnelTwoEndX_;
+}
+
+void Simulation::gameOver(bool isWin)
+{
+  isGameOver_ = true;
+  isGameOverWin_ = isWin;
+  
+  // TODO: Set up game state so that we can reset and restart the level.
+}
+
+bool Simulation::isCollidingWithActor(Actor *actorA, Actor *actorB)
+{
+//  if (actorA == pacman_ || actorB == pacman_) return false;
+  int aTileX = actorA->getTileX();
+  int aTileY = actorA->getTileY();
+  int bTileX = actorB->getTileX();
+  int bTileY = actorB->getTileY();
+  
+  return (aTileX == bTileX && aTileY == bTileY);
+}
+
+bool Simulation::isCollidingWithTile(Actor *actor, int tileX, int tileY)
+{
+  // All in sub-pixels, as actors can be part way through a pixel.
+  int tileSize = TILE_SIZE * Actor::SUBPIXELS;
+  
+  // How far away the top side of the actor is from the top of the screen.
+  int topActor = actor->getSubpixelY();
+  // How far away the bottom side of the actor is from the top of the screen.
+  int botActor = topActor + tileSize;
+  // How far away the left side of the actor is from the left of the screen.
+  int leftActor = actor->getSubpixelX();
+  // How far away the right side of the actor is from the left of the screen.
+  int rightActor = leftActor + tileSize;
+  
+  // How far away the top side of the tile is from the top of the screen.
+  int topTile = (tileY * tileSize);
+  // How far away the bottom side of the tile is from the top of the screen.
+  int botTile = topTile + tileSize;
+  // How far away the left side of the tile is from the left of the screen.
+  int leftTile = (tileX * tileSize);
+  // How far away the right side of the tile is from the left of the screen.
+  int rightTile = leftTile + tileSize;
+  
+  if (botActor <= topTile) return false;
+  if (botTile <= topActor) return false;
+  
+  if (rightActor <= leftTile) return false;
+  if (rightTile <= leftActor) return false;
+  
+  return true;
+}
+
+bool Simulation::movePacmanForwardWithCollision()
+{
+  bool success = true;
+  // TODO: Use, WHERE IS PACMAN WITHIN THE TILE IT IS IN?, to detect if collision.
+  //
+  // First try move PACMAN forward without worrying about collision.
+  pacman_->moveForward();
+  
+  // Which tile is the center of PACMAN now on?
+  int pacmanX = pacman_->getTileX();
+  int pacmanY = pacman_->getTileY();
+  TileType tile;
+
+  // Get all the tiles surrounding that tile.
+  for (int i = -1; i <= 1; i++) {
+    for (int j = -1; j <= 1; j++) {
+      // And check if any are walls. Tiles beyond the edge of the
+      // board are walls too, so need no special handling.
+      tile = board_.getTile(pacmanX + i, pacmanY + j);
+      if (isCollidingWithTile(pacman_, pacmanX + i, pacmanY + j)) {
+        // Resolve collision.
+        if (tile == TILE_WALL) {
+          success = false;
+          break;
+        } else if (tile == TILE_GATE) {
+          success = false;
+          break;
+        }
+      }
+    }
+  }
+  
+  // If none of the tiles are walls, then successfully moved.
+  if (success) for (int i = -1; i <= 1; i++) for (int j = -1; j <= 1; j++) {
+    // Check if any of the tiles are pellets, power pellets, and so on.
+    int tileX = pacmanX + i;
+    int tileY = pacmanY + j;
+    tile = board_.getTile(tileX, tileY);
+    if (isCollidingWithTile(pacman_, tileX, tileY)) {
+      if (tile == TILE_PELLET) {
+        pellets_ += 1;
+        for (int i = 0; i < numGhosts_; i++) {
+          Actor *ghost = ghosts_[i];
+          if (ghost->getWaitingPellets() > 0) {
+            ghost->setWaitingPellets(ghost->getWaitingPellets() - 1);
+          }
+        }
+        board_.setTile(pacmanX + i, pacmanY + j, TILE_NONE);
+        boardVersion_++;
+        if (pellets_ == totalPellets_) {
+          // PACMAN has collected all pellets.
+          gameOver(true);
+        }
+      } else if (tile == TILE_POWER_PELLET) {
+        // Power pellet last 6 seconds, 6000 milliseconds.
+        pacman_->setPower(msToTicks(6000));
+        board_.setTile(pacmanX + i, pacmanY + j, TILE_NONE);
+        boardVersion_++;
+        for (int i = 0; i < numGhosts_; i++) {
+          Actor *ghost = ghosts_[i];
+          GHOST_STATE state = ghost->getState();
+          if (state == GHOST_CHASE || state == GHOST_SCATTER) {
+            ghost->setState(GHOST_FRIGHTENED);
+            isFrightenedFlashing_ = false;
+            ghost->turnAround();
+          }
+        }
+      } else if (tile == TILE_PORTAL) {
+        if (pacman_->isAt(tileX * TILE_SIZE, tileY * TILE_SIZE)) {
+          // We should be exactly in a portal.
+          if (tileX == portalOneX && tileY == portalOneY) {
+            pacman_->setTileX(portalTwoX);
+            pacman_->setTileY(portalTwoY);
+            pacman_->setDirection(DIRECTION_LEFT);
+          } else if (tileX == portalTwoX && tileY == portalTwoY) {
+            pacman_->setTileX(portalOneX);
+            pacman_->setTileY(portalOneY);
+            pacman_->setDirection(DIRECTION_RIGHT);
+          } else {
+            assert(!"We should be exactly in a portal...");
+          }
+        }
+      }
+    }
+  }
+  
+  if (!success) {
+    // If any of the tiles are walls, reverse PACMAN.
+    pacman_->moveBackward();
+  } else /* if (success) */ {
+    // Successfully moved. Check if crash with any ghosts, which
+    // can only be the ghosts in the same tile as PACMAN.
+    for (int i = occupancy_.getFirst(pacman_->getTileX(), pacman_->getTileY());
+         i != -1; i = occupancy_.getNext(i)) {
+      Actor *ghost = ghosts_[i];
+      if (isCollidingWithActor(pacman_, ghost)) {
+        // If Ghost is eaten, pass through it regardless of power.
+        if (ghost->getState() != GHOST_EATEN) {
+          // If Ghost is not eaten, PACMAN survives only if Ghost
+          // is Frightened, AND if PACMAN has remaining power left
+          // to eat the Ghost.
+          if (ghost->getState() == GHOST_FRIGHTENED && (pacman_->getPower() > 0)) {
+            ghost->setState(GHOST_EATEN);
+          } else {
+            gameOver(false);
+          }
+        }
+      }
+    }
+  }
+  
+  return success;
+}
+
+bool Simulation::moveGhostForwardWithCollision(Actor *ghost)
+{
+  bool success = true;
+  
+  // Move this ghost forward without worrying about collision.
+  ghost->moveForward();
+  
+  // Which tile is the center of this ghost now on?
+  int ghostX = ghost->getTileX();
+  int ghostY = ghost->getTileY();
+  TileType tile;
+
+  // Get all the tiles surrounding that tile.
+  for (int i = -1; i <= 1; i++) {
+    for (int j = -1; j <= 1; j++) {
+      // And check if any are walls. Tiles beyond the edge of the
+      // board are walls too, so need no special handling.
+      tile = board_.getTile(ghostX + i, ghostY + j);
+      if (isCollidingWithTile(ghost, ghostX + i, ghostY + j)) {
+        // Resolve collision.
+        if (tile == TILE_WALL) {
+          success = false;
+          break;
+        } else if (tile == TILE_GATE) {
+          // Can pass through gate only:
+          GHOST_STATE state = ghost->getState();
+          if (state == GHOST_FINDING_SPOT || state == GHOST_FINDING_EXIT) {
+            // If are trying to enter or leave base.
+            success = true;
+          } else {
+            // Otherwise, is just a normal wall.
+            success = false;
+          }
+        }
+      }
+    }
+  }
+  
+  if (!success) {
+    // If any of the tiles are walls, reverse this ghost.
+    ghost->moveBackward();
+  } else {
+    // Successfully moved. Check if this ghost crashed into PACMAN.
+    if (isCollidingWithActor(ghost, pacman_)) {
+      // If Ghost is eaten, pass through it regardless of power.
+      if (ghost->getState() != GHOST_EATEN) {
+        // If Ghost is not eaten, PACMAN survives only if Ghost
+        // is Frightened, AND if PACMAN has remaining power left
+        // to eat the Ghost.
+        if (ghost->getState() == GHOST_FRIGHTENED && (pacman_->getPower() > 0)) {
+          ghost->setState(GHOST_EATEN);
+        } else {
+          gameOver(false);
+        }
+      }
+    }
+    // And if this ghost has been eaten, Check if they have returned home.
+    if (ghost->getState() == GHOST_EATEN) {
+      if (ghost->isAt((baseEntranceX_ * TILE_SIZE) + (TILE_SIZE / 2),
+                      baseEntranceY_ * TILE_SIZE)) {
+        // Ghost has arrived at the entrace of the homebase, Ghost is
+        // no longer eaten. Instead, is now entering the homebase to
+        // find its appropriate spot in the base. Once have arrived at
+        // that spot, will then immediately start to escape, find exit.
+        ghost->setState(GHOST_FINDING_SPOT);
+      }
+    }
+    
+    // If this ghost is in a portal, check if they are exactly in the portal.
+    int ghostTileX = ghost->getTileX();
+    int ghostTileY = ghost->getTileY();
+    if (board_.getTile(ghostTileX, ghostTileY) == TILE_PORTAL) {
+      if (ghost->isAt(ghostTileX * TILE_SIZE, ghostTileY * TILE_SIZE)) {
+        // We should be exactly in a portal.
+        if (ghostTileX == portalOneX && ghostTileY == portalOneY) {
+          ghost->setTileX(portalTwoX);
+          ghost->setTileY(portalTwoY);
+        } else if (ghostTileX == portalTwoX && ghostTileY == portalTwoY) {
+          ghost->setTileX(portalOneX);
+          ghost->setTileY(portalOneY);
+        } else {
+          assert(!"We should be exactly in a portal...");
+        }
+      }
+    }
+  }
+  
+  return success;
+}
+
+void Simulation::setChaseOrScatter(Actor *ghost)
+{
+  if (currentMode_ == false) {
+    ghost->setState(GHOST_SCATTER);
+  } else {
+    ghost->setState(GHOST_CHASE);
+  }
+}
+
+void Simulation::moveGhost(Actor *ghost, int targetTileX, int targetTileY)
+{
+  ghost->setTargetTileX(targetTileX);
+  ghost->setTargetTileY(targetTileY);
+  int ghostTileX = ghost->getTileX();
+  int ghostTileY = ghost->getTileY();
+  
+  // How fast this ghost moves on this tick.
+  GHOST_STATE speedState = ghost->getState();
+  if (speedState != GHOST_EATEN && isInTunnel(ghost)) {
+    ghost->startTick(ghostTunnelSpeed_);
+  } else {
+    ghost->startTick(ghostSpeeds_[speedState]);
+  }
+
+  // At the start of game, waiting until can start to leave home.
+  if (ghost->getWaitingPellets() == 0) {
+    // Start to leave home!
+    ghost->setState(GHOST_FINDING_EXIT);
+    ghost->setWaitingPellets(-1);
+  } else if (ghost->getWaitingPellets() > 0){
+    // Continue going forward and back, bouncing
+    // against walls while waiting to leave base.
+    if (!moveGhostForwardWithCollision(ghost)) {
+      ghost->turnAround();
+      moveGhostForwardWithCollision(ghost);
+    }
+    return;
+  }
+  
+  assert(ghost->getWaitingPellets() == -1);
+  
+  GHOST_STATE state = ghost->getState();
+  if (state == GHOST_FINDING_EXIT) {
+    // Ghost is looking for exit.
+    int gatesX = (baseEntranceX_ * TILE_SIZE) + (TILE_SIZE / 2);
+    if (ghost->isAt(gatesX, baseEntranceY_ * TILE_SIZE)) {
+      // Finished walking out of the base.
+      setChaseOrScatter(ghost);
+    } else if (!ghost->isAtX(gatesX)) {
+      // If are not aligned with the gates, then continue
+      // walking left/right until are aligned with the gates.
+      if (ghost->getSubpixelX() < gatesX * Actor::SUBPIXELS) {
+        ghost->setDirection(DIRECTION_RIGHT);
+      } else {
+        ghost->setDirection(DIRECTION_LEFT);
+      }
+      moveGhostForwardWithCollision(ghost);
+    } else /* if (ghost->isAtX(gatesX)) */ {
+      // If are aligned with the gates, then continue walking
+      // up until have left the gates left the base.
+      ghost->setDirection(DIRECTION_UP);
+      moveGhostForwardWithCollision(ghost);
+    }
+  } else if (state == GHOST_FINDING_SPOT) {
+    // Ghost is looking for their spot within the home base.
+    if (ghost->isAt(ghost->getSpotInBaseX(), ghost->getSpotInBaseY())) {
+      // Have reached their spot in base. From next
+      // frame onwards start looking for exit again.
+      ghost->setState(GHOST_FINDING_EXIT);
+    } else if (!ghost->isAtY(baseSpotY_)) {
+      // Ghost is aiming for pinky's height.
+      ghost->setDirection(DIRECTION_DOWN);
+      moveGhostForwardWithCollision(ghost);
+    } else {
+      // Once at pinky's height, just move left or right until reach spot.
+      if (ghost->getSpotInBaseX() < baseSpotX_) {
+        ghost->setDirection(DIRECTION_LEFT);
+      } else {
+        ghost->setDirection(DIRECTION_RIGHT);
+      }
+      moveGhostForwardWithCollision(ghost);
+    }
+  } else if (state == GHOST_FRIGHTENED) {
+    if (ghost->isAt(ghostTileX * TILE_SIZE, ghostTileY * TILE_SIZE)) {
+      // FIXME: can be not exactly in a tile and will have to choose next direction to turn.
+      // We are exactly on a tile. If it is a junction, then randomly choose
+      // a direction to turn, either left, right, or continue forward.
+      Direction oldDirection = ghost->getDirection();
+      int exits = tileExits_.getExits(ghostTileX, ghostTileY) &
+                  ~getDirectionBit(getOppositeDirection(oldDirection));
+      int numExits = 0;
+      for (int d = DIRECTION_UP; d <= DIRECTION_RIGHT; d++) {
+        if (exits & getDirectionBit((Direction)d)) numExits++;
+      }
+      if (numExits > 0) {
+        // Every exit is walkable, so whichever is picked, the move will succeed.
+        int pick = (numExits == 1) ? 0 : random_.nextInt(numExits);
+        for (int d = DIRECTION_UP; d <= DIRECTION_RIGHT; d++) {
+          if ((exits & getDirectionBit((Direction)d)) && pick-- == 0) {
+            ghost->setDirection((Direction)d);
+            break;
+          }
+        }
+        moveGhostForwardWithCollision(ghost);
+      }
+    } else {
+      // Not at an intersection. Keep moving forward until are at an intersection.
+      moveGhostForwardWithCollision(ghost);
+    }
+  } else {
+    // Case for if scatter or chase or eaten.
+    // Checking if this ghost should transition between
+    // the Chase/Scatters state on this frame.
+    // If the ghost does change state on this frame,
+    // then we will also flip them around.
+    if (ghost->getState() == GHOST_SCATTER) {
+      setChaseOrScatter(ghost);
+      if (ghost->getState() == GHOST_CHASE) {
+        ghost->turnAround();
+      }
+    } else if (ghost->getState() == GHOST_CHASE) {
+      setChaseOrScatter(ghost);
+      if (ghost->getState() == GHOST_SCATTER) {
+        ghost->turnAround();
+      }
+    }
+    
+    // Follow the given target tile, provided by caller, choosing a new
+    // direction only where there is a choice to make. Between tiles, keep
+    // going: this includes a Ghost that has just flipped, whose new
+    // direction should be the direction it is headed, rather than any
+    // direction related to reaching the given target tile.
+    if (ghost->isAt(ghostTileX * TILE_SIZE, ghostTileY * TILE_SIZE)) {
+      // Have arrived completely into a new tile. Never turn straight back,
+      // and if that leaves only one way on, there is nothing to decide.
+      Direction oldDirection = ghost->getDirection();
+      int exits = tileExits_.getExits(ghostTileX, ghostTileY) &
+                  ~getDirectionBit(getOppositeDirection(oldDirection));
+      Direction ranked[4];
+      if (exits != 0 && (exits & (exits - 1)) == 0) {
+        // In a corridor, or round a corner: follow it.
+        ghost->setDirection(getOnlyDirection(exits));
+        moveGhostForwardWithCollision(ghost);
+      } else if (rankDirections(ghostTileX, ghostTileY, exits, targetTileX, targetTileY, ranked) > 0) {
+        // At a junction. Every exit is walkable, so the move will succeed.
+        ghost->setDirection(ranked[0]);
+        moveGhostForwardWithCollision(ghost);
+      }
+    } else if (ghost->isAt((baseEntranceX_ * TILE_SIZE) + (TILE_SIZE / 2),
+                           baseEntranceY_ * TILE_SIZE)) {
+      // Right outside the front gates of the home base, which is where
+      // Blinky starts. This is half way between two tiles, so it is not
+      // in tileExits_: try each way, closest to the target first.
+      Direction oldDirection = ghost->getDirection();
+      int exits = getDirectionBit(DIRECTION_UP) | getDirectionBit(DIRECTION_DOWN) |
+                  getDirectionBit(DIRECTION_LEFT) | getDirectionBit(DIRECTION_RIGHT);
+      exits &= ~getDirectionBit(getOppositeDirection(oldDirection));
+      Direction ranked[4];
+      int numRanked = rankDirections(ghostTileX, ghostTileY, exits, targetTileX, targetTileY, ranked);
+      for (int i = 0; i < numRanked; i++) {
+        ghost->setDirection(ranked[i]);
+        if (moveGhostForwardWithCollision(ghost)) {
+          break;
+        }
+      }
+    } else {
+      // Otherwise, continue moving this ghost forward towards the tile
+      // in front of it. Will eventually be exactly in that tile.
+      moveGhostForwardWithCollision(ghost);
+    }
+  }
+}
+
+template <typename Targeting>
+void Simulation::moveGhosts(int personality, TargetInputs in)
+{
+  for (int i = personality; i < numGhosts_; i += NUM_PERSONALITIES) {
+    Actor *ghost = ghosts_[i];
+    Actor *partner = ghosts_[i - personality];
+    in.state = ghost->getState();
+    in.tileX = ghost->getTileX();
+    in.tileY = ghost->getTileY();
+    in.partnerTileX = partner->getTileX();
+    in.partnerTileY = partner->getTileY();
+    in.scatterTileX = ghost->getScatterTileX();
+    in.scatterTileY = ghost->getScatterTileY();
+    in.spotTileX = ghost->getSpotInBaseX() / TILE_SIZE;
+    in.spotTileY = ghost->getSpotInBaseY() / TILE_SIZE;
+    
+    int targetTileX;
+    int targetTileY;
+    Targeting::find(in, &targetTileX, &targetTileY);
+    if (i == controlledGhost_) {
+      steerGhost(ghost, &targetTileX, &targetTileY);
+    }
+    moveGhost(ghost, targetTileX, targetTileY);
+    occupancy_.move(i, ghost->getTileX(), ghost->getTileY());
+  }
+}
+
+bool Simulation::updateActors(Direction newDirection)
+{
+  /* No point updating if game is over. */
+  if (isGameOver_) {
+    return true;
+  }
+
+  bool success = true;
+  
+  /* First move PACMAN. */
+  
+  // Moving PACMAN, a little faster while PACMAN has power.
+  pacman_->startTick((pacman_->getPower() > 0) ? pacmanPowerSpeed_ : pacmanSpeed_);
+  Direction oldDirection = pacman_->getDirection();
+  if (newDirection == DIRECTION_NONE) {
+    success = movePacmanForwardWithCollision();
+  } else /* if (newDirection != DIRECTION_NONE) */ {
+    pacman_->setDirection(newDirection);
+    if (!movePacmanForwardWithCollision()) {
+      // There was a collision with a wall. Change back
+      // to old direction and try move forward again.
+      success = false;
+      pacman_->setDirection(oldDirection);
+      movePacmanForwardWithCollision();
+    }
+  }
+  
+  /* Then move the ghosts. */
+  
+  // Game starts when PACMAN starts moving. Don't
+  // move ghosts if PACMAN hasn't started moving.
+  if (pacman_->getDirection() == DIRECTION_NONE) {
+    currentMode_ = false; // Ghosts start off in Scatter mode.
+    currentModeIndex_ = 0;
+  } else /* if (pacman_->getDirection() != DIRECTION_NONE) */ {
+    if (!isModeTimerRunning_) {
+      // We start the mode timer for the first time when we know
+      // for sure that Player has started controlling PACMAN.
+      isModeTimerRunning_ = true;
+      modeTicks_ = 0;
+    } else /* if (isModeTimerRunning_) */ {
+      modeTicks_++;
+      // Check if ghosts should be mode switching on this tick using timer.
+      if (modes_[currentModeIndex_] == -1) {
+        // Ghosts should be staying in chase mode on this tick.
+        currentMode_ = true;
+      } else if (modeTicks_ / ticksPerSecond_ > modes_[currentModeIndex_]) {
+        // Ghosts should switch to opposite mode on this tick.
+        currentModeIndex_++;
+        currentMode_ = !currentMode_;
+        // Re-Start timer to count how long the new mode should last.
+        modeTicks_ = 0;
+      }
+    }
+    // What every ghost's target depends on, other than the ghost itself.
+    TargetInputs in;
+    in.pacmanTileX = pacman_->getTileX();
+    in.pacmanTileY = pacman_->getTileY();
+    getAhead(pacman_->getDirection(), &in.pacmanAheadX, &in.pacmanAheadY);
+    in.homeTileX = baseEntranceX_;
+    in.homeTileY = baseEntranceY_;
+    
+    // Move each group of ghosts in turn, ghost by ghost.
+    moveGhosts<BlinkyTargeting>(0, in);
+    moveGhosts<InkyTargeting>(1, in);
+    moveGhosts<PinkyTargeting>(2, in);
+    moveGhosts<ClydeTargeting>(3, in);
+  }
+  
+  // Tick is finished. Drain PACMAN of one tick of power.
+  if (pacman_->getPower() > 0) {
+    // If PACMAN has power left, reduce by one tick.
+    pacman_->setPower(pacman_->getPower() - 1);
+    // Flash frightened ghosts 3 times in the last 1.5 seconds.
+    if (pacman_->getPower() == msToTicks(1500)) {
+      isFrightenedFlashing_ = true;
+    } else if (pacman_->getPower() == msToTicks(1250)) {
+      isFrightenedFlashing_ = false;
+    } else if (pacman_->getPower() == msToTicks(1000)) {
+      isFrightenedFlashing_ = true;
+    } else if (pacman_->getPower() == msToTicks(750)) {
+      isFrightenedFlashing_ = false;
+    } else if (pacman_->getPower() == msToTicks(500)) {
+      isFrightenedFlashing_ = true;
+    } else if (pacman_->getPower() == msToTicks(250)) {
+      isFrightenedFlashing_ = false;
+    }
+  }
+  if (pacman_->getPower() == 0) {
+    pacman_->setPower(-1);
+    // Pacman has run out of power,
+    // Un-Frighten all ghosts before next tick starts.
+    for (int i = 0; i < numGhosts_; i++) {
+      Actor *ghost = ghosts_[i];
+      if (ghost->getState() == GHOST_FRIGHTENED) {
+        setChaseOrScatter(ghost);
+      }
+    }
+  }
+  
+  return success;
+}
+
+bool Simulation::update(Direction newDirection)
+{
+  bool success = updateActors(newDirection);
+  if (!success) {
+    // Failed to update PACMAN to new direction, PACMAN is pressing
+    // against a wall rather than chomping along a corridor.
+    pacmanAnimationFrame_ = 0;
+  }
+  
+  if (pacman_->getDirection() != DIRECTION_NONE) {
+    // Update PACMAN's animation frame every five ticks.
+    pacmanAnimationFrameCounter_++;
+    if (pacmanAnimationFrameCounter_ % 5 == 0) {
+      pacmanAnimationFrameCounter_ = 0;
+      // Update PACMAN's animation frame.
+      pacmanAnimationFrame_ = (pacmanAnimationFrame_ == 0) ? 1 : 0;
+    }
+  }
+  
+  pelletAnimationFrameCounter_++;
+  if (pelletAnimationFrameCounter_ % 10 == 0) {
+    pelletAnimationFrameCounter_ = 0;
+    // Update pellet's animation frame.
+    pelletAnimationFrame_ = (pelletAnimationFrame_ == 0) ? 1 : 0;
+  }
+  
+  return success;
+}
+
+bool Simulation::update(Direction newDirection, Direction ghostDirection)
+{
+  ghostDirection_ = ghostDirection;
+  bool success = update(newDirection);
+  ghostDirection_ = DIRECTION_NONE;
+  return success;
+}
+
+void Simulation::setControlledGhost(int i)
+{
+  controlledGhost_ = i;
+}
+
+void Simulation::steerGhost(Actor *ghost, int *targetTileX, int *targetTileY)
+{
+  GHOST_STATE state = ghost->getState();
+  if (ghostDirection_ == DIRECTION_NONE || (state != GHOST_CHASE && state != GHOST_SCATTER)) {
+    return;
+  }
+  // As far as the board goes that way, so that the ghost keeps heading
+  // that way at every junction, rather than settling on a tile.
+  int tileX = ghost->getTileX();
+  int tileY = ghost->getTileY();
+  if (ghostDirection_ == DIRECTION_UP) tileY = 0;
+  if (ghostDirection_ == DIRECTION_DOWN) tileY = boardHeight_ - 1;
+  if (ghostDirection_ == DIRECTION_LEFT) tileX = 0;
+  if (ghostDirection_ == DIRECTION_RIGHT) tileX = boardWidth_ - 1;
+  *targetTileX = tileX;
+  *targetTileY = tileY;
+}
+
+bool Simulation::saveState(SimulationState *state)
+{
+  if (numGhosts_ > SimulationState::MAX_GHOSTS) {
+    printf("Can't save a game of %d ghosts, at most %d!\n", numGhosts_,
+           SimulationState::MAX_GHOSTS);
+    return false;
+  }
+  if (board_.getNumBytes() > SimulationState::MAX_TILE_BYTES) {
+    printf("Can't save a game on a %dx%d board, at most %d tiles counting the border!\n",
+           boardWidth_, boardHeight_, SimulationState::MAX_TILE_BYTES);
+    return false;
+  }
+  state->numGhosts = numGhosts_;
+  state->numTileBytes = board_.getNumBytes();
+  state->random = random_;
+  state->pacman = *pacman_;
+  for (int i = 0; i < numGhosts_; i++) {
+    state->ghosts[i] = *ghosts_[i];
+  }
+  state->currentModeIndex = currentModeIndex_;
+  state->modeTicks = modeTicks_;
+  state->pellets = pellets_;
+  state->pacmanAnimationFrame = pacmanAnimationFrame_;
+  state->pacmanAnimationFrameCounter = pacmanAnimationFrameCounter_;
+  state->pelletAnimationFrame = pelletAnimationFrame_;
+  state->pelletAnimationFrameCounter = pelletAnimationFrameCounter_;
+  state->isModeTimerRunning = isModeTimerRunning_;
+  state->currentMode = currentMode_;
+  state->isGameOver = isGameOver_;
+  state->isGameOverWin = isGameOverWin_;
+  state->isFrightenedFlashing = isFrightenedFlashing_;
+  board_.save(state->tiles);
+  return true;
+}
+
+void Simulation::restoreState(const SimulationState *state)
+{
+  assert(state->numGhosts == numGhosts_ && state->numTileBytes == board_.getNumBytes());
+  random_ = state->random;
+  *pacman_ = state->pacman;
+  for (int i = 0; i < numGhosts_; i++) {
+    *ghosts_[i] = state->ghosts[i];
+    // Which ghosts are in which tile only depends on where they are, and
+    // PACMAN's checks don't depend on the order they are listed in a tile.
+    occupancy_.move(i, ghosts_[i]->getTileX(), ghosts_[i]->getTileY());
+  }
+  currentModeIndex_ = state->currentModeIndex;
+  modeTicks_ = state->modeTicks;
+  pellets_ = state->pellets;
+  pacmanAnimationFrame_ = state->pacmanAnimationFrame;
+  pacmanAnimationFrameCounter_ = state->pacmanAnimationFrameCounter;
+  pelletAnimationFrame_ = state->pelletAnimationFrame;
+  pelletAnimationFrameCounter_ = state->pelletAnimationFrameCounter;
+  isModeTimerRunning_ = state->isModeTimerRunning;
+  currentMode_ = state->currentMode;
+  isGameOver_ = state->isGameOver;
+  isGameOverWin_ = state->isGameOverWin;
+  isFrightenedFlashing_ = state->isFrightenedFlashing;
+  board_.restore(state->tiles);
+  // The tiles may now differ from any copy, even if as many were eaten.
+  boardVersion_++;
+}
+
+int Simulation::getBoardWidth()
+{
+  return boardWidth_;
+}
+
+int Simulation::getBoardHeight()
+{
+  return boardHeight_;
+}
+
+TileType Simulation::getTile(int tileX, int tileY)
+{
+  return board_.getTile(tileX, tileY);
+}
+
+Actor *Simulation::getPacman()
+{
+  return pacman_;
+}
+
+int Simulation::getNumGhosts()
+{
+  return numGhosts_;
+}
+
+Actor *Simulation::getGhost(int i)
+{
+  return ghosts_[i];
+}
+
+Actor *Simulation::getBlinky()
+{
+  return (numGhosts_ > 0) ? ghosts_[0] : NULL;
+}
+
+Actor *Simulation::getInky()
+{
+  return (numGhosts_ > 1) ? ghosts_[1] : NULL;
+}
+
+Actor *Simulation::getPinky()
+{
+  return (numGhosts_ > 2) ? ghosts_[2] : NULL;
+}
+
+Actor *Simulation::getClyde()
+{
+  return (numGhosts_ > 3) ? ghosts_[3] : NULL;
+}
+
+int Simulation::getPellets()
+{
+  return pellets_;
+}
+
+int Simulation::getTotalPellets()
+{
+  return totalPellets_;
+}
+
+int Simulation::getBoardVersion()
+{
+  return boardVersion_;
+}
+
+bool Simulation::isGameOver()
+{
+  return isGameOver_;
+}
+
+bool Simulation::isGameOverWin()
+{
+  return isGameOverWin_;
+}
+
+int Simulation::getPacmanAnimationFrame()
+{
+  return pacmanAnimationFrame_;
+}
+
+int Simulation::getPelletAnimationFrame()
+{
+  return pelletAnimationFrame_;
+}
+
+bool Simulation::isFrightenedFlashing()
+{
+  return isFrightenedFlashing_;
+}
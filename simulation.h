@@ -0,0 +1,307 @@
+#ifndef simulation_h
+#define simulation_h
+
+#include <stddef.h>
+#include <type_traits>
+#include "actor.h"
+#include "board.h"
+#include "direction.h"
+#include "occupancy.h"
+#include "random.h"
+#include "targeting.h"
+#include "tile.h"
+#include "tileexits.h"
+
+class Level;
+
+/**
+ * Everything about a game that changes as it is played, in one plain
+ * block of memory, so a game can be saved and put back exactly as it was
+ * with a couple of copies, e.g. to roll back and replay ticks (see
+ * netplay.h). What never changes (the level, speeds, mode schedule) stays
+ * in the Simulation, so a state can only be restored into the simulation
+ * it came from, or one set up the same way.
+ *
+ * Fixed size, so states can be kept in arrays or sent as they are, but
+ * only the first numGhosts ghosts and numTileBytes tiles are used. So
+ * only games with at most MAX_GHOSTS ghosts, on a board of at most
+ * MAX_TILE_BYTES tiles counting its border, can be saved: the default
+ * 28x36 board takes 30x38, 1140 bytes, leaving room for boards up to
+ * about 62x62.
+ */
+struct SimulationState {
+  static const int MAX_GHOSTS = 8;
+  static const int MAX_TILE_BYTES = 4096; // Including the border, see Board.
+
+  int numGhosts;
+  int numTileBytes;
+  Random random;
+  Actor pacman;
+  Actor ghosts[MAX_GHOSTS];
+  int currentModeIndex;
+  int modeTicks;
+  int pellets;
+  int pacmanAnimationFrame;
+  int pacmanAnimationFrameCounter;
+  int pelletAnimationFrame;
+  int pelletAnimationFrameCounter;
+  bool isModeTimerRunning;
+  bool currentMode;
+  bool isGameOver;
+  bool isGameOverWin;
+  bool isFrightenedFlashing;
+  uint8_t tiles[MAX_TILE_BYTES];
+};
+
+static_assert(std::is_trivially_copyable<SimulationState>::value,
+              "SimulationState must be copyable as plain memory");
+
+/**
+ * The rules of the game, with no window attached: the board, PACMAN,
+ * the ghosts and the Scatter/Chase mode schedule. Stepping the
+ * simulation never touches SDL, so it can be driven as fast as the CPU
+ * allows (tests, bots, batch runs), or once per frame by Game.
+ */
+class Simulation {
+  public:
+    /**
+     * Initialise simulation with the given level, or the default level
+     * if NULL. The level is only read here, so can be freed once this
+     * returns, or shared by many simulations.
+     *
+     * The simulation is stepped ticksPerSecond times per second. Mode and
+     * power durations, and speeds, are converted to ticks using this
+     * rate, so the game plays the same at any rate.
+     *
+     * Frightened ghosts choose where to go using random numbers from the
+     * given seed. Two simulations with the same rate and seed, updated
+     * with the same directions, play out exactly the same.
+     *
+     * There can be any number of ghosts, at least one. Ghosts take turns
+     * being Blinky, Inky, Pinky and Clyde, so ghost i acts like ghost
+     * (i % NUM_PERSONALITIES) and starts where that ghost does in the level.
+     */
+    Simulation(int ticksPerSecond = DEFAULT_TICKS_PER_SECOND, uint32_t seed = 1,
+               Level *level = NULL, int numGhosts = DEFAULT_NUM_GHOSTS);
+    ~Simulation();
+
+    // Return whether simulation initialisation succeeded.
+    bool getSuccess();
+
+    int getTicksPerSecond();
+    uint32_t getSeed();
+
+    /**
+     * Update our simulation by one tick:
+     *
+     * - The player wants PACMAN to change to the given direction on this
+     *   tick, and then move forward one step in the new direction.
+     *
+     * - If PACMAN is unable to move forward one step in the new direction,
+     *   then don't change to new direction, remain in old direction, and
+     *   move forward one step (if are able to) in the old direction.
+     *
+     * - If PACMAN does successfully change direction, the user wants
+     *   PACMAN to remain in this direction, until their next successful
+     *   request for a change in direction.
+     *
+     * Also advances the PACMAN and power pellet animation frames.
+     *
+     * \Returns If PACMAN successfully changed direction to the new direction.
+     */
+    bool update(Direction newDirection);
+    
+    /**
+     * As update(), but with a player steering the controlled ghost (see
+     * setControlledGhost()) towards ghostDirection, or leaving it to chase
+     * as usual if DIRECTION_NONE.
+     */
+    bool update(Direction newDirection, Direction ghostDirection);
+    
+    /**
+     * Hand ghost i over to a player, or back to the game if -1, which is
+     * the default. While chasing or scattering, a controlled ghost heads
+     * for the edge of the board in the direction the player asks for,
+     * under the same rules as every other ghost: it only turns where
+     * corridors meet, and never turns straight back.
+     */
+    void setControlledGhost(int i);
+    
+    /**
+     * Copy the state of the game into state.
+     * \Returns false, printing which, if the game has too many ghosts or
+     * too big a board to fit in a SimulationState.
+     */
+    bool saveState(SimulationState *state);
+    
+    // Put the game back as it was when state was saved from it.
+    void restoreState(const SimulationState *state);
+
+    // The board, in tile space. Tiles one beyond
+    // any edge of the board can be read, and are walls.
+    int getBoardWidth();
+    int getBoardHeight();
+    TileType getTile(int tileX, int tileY);
+
+    Actor *getPacman();
+    int getNumGhosts();
+    Actor *getGhost(int i);
+    // The first ghost of each personality, or NULL if there are too few ghosts.
+    Actor *getBlinky();
+    Actor *getInky();
+    Actor *getPinky();
+    Actor *getClyde();
+
+    int getPellets();
+    int getTotalPellets();
+    // Goes up every time any tile changes, eaten or put back by
+    // restoreState(), and never goes down, so a copy of the board is
+    // stale if this has moved. Not part of the saved state.
+    int getBoardVersion();
+    bool isGameOver();
+    bool isGameOverWin();
+
+    // For animations.
+    int getPacmanAnimationFrame();
+    int getPelletAnimationFrame();
+
+    // Should frightened ghosts be drawn flashing on this tick?
+    bool isFrightenedFlashing();
+
+    static const int DEFAULT_TICKS_PER_SECOND = 60;
+    static const int DEFAULT_NUM_GHOSTS = 4;
+    // Blinky, Inky, Pinky and Clyde, in that order.
+    static const int NUM_PERSONALITIES = 4;
+    static const int TILE_SIZE = 24;
+    
+    // How many seconds to stay in each mode, starting with Scatter mode
+    // and alternating with Chase mode. -1 is forever.
+    static const int NUM_MODES = 8;
+    static const int MODE_SCHEDULE[NUM_MODES];
+    
+    // Speeds, as percentages of FULL_SPEED pixels per second,
+    // following the first level of the arcade game.
+    static const int FULL_SPEED = 225;
+    static const int PACMAN_SPEED = 80;
+    static const int PACMAN_POWER_SPEED = 90;   // While PACMAN has power.
+    static const int GHOST_TUNNEL_SPEED = 40;   // In a tunnel to a portal, unless eaten.
+    static const int GHOST_SPEEDS[NUM_GHOST_STATES];
+
+  private:
+    // For timing the steps of a tick on their own, see bench.cpp.
+    friend class SimulationBench;
+
+    void gameOver(bool isWin);
+
+    bool isCollidingWithActor(Actor *actorA, Actor *actorB);
+
+    bool isCollidingWithTile(Actor *actor, int tileX, int tileY);
+
+    /**
+     * Move PACMAN forward while accounting for collision
+     * within our game world.
+     *
+     * \Returns If PACMAN successfully moved forward.
+     */
+    bool movePacmanForwardWithCollision();
+
+    bool moveGhostForwardWithCollision(Actor *ghost);
+
+    void moveGhost(Actor *ghost, int targetTileX, int targetTileY);
+
+    /**
+     * Move every ghost of the given personality (ghosts personality,
+     * personality + NUM_PERSONALITIES, ...), each towards the target the
+     * Targeting policy (see targeting.h) picks for it. in holds PACMAN's
+     * part of the targets, the rest is filled in ghost by ghost.
+     */
+    template <typename Targeting>
+    void moveGhosts(int personality, TargetInputs in);
+
+    /**
+     * Use the mode schedule to set if this ghost should be in Chase or Scatter mode.
+     */
+    void setChaseOrScatter(Actor *ghost);
+
+    /**
+     * Move PACMAN and the ghosts by one tick. Same contract as update(),
+     * minus the animations.
+     */
+    bool updateActors(Direction newDirection);
+
+    // Convert a duration in ms into a whole number of ticks.
+    int msToTicks(int ms);
+    
+    // Convert a speed in percent of FULL_SPEED into sub-pixels per tick.
+    int percentToSpeed(int percent);
+    
+    // Is this actor in one of the tunnels leading to the portals?
+    bool isInTunnel(Actor *actor);
+    
+    // Point the controlled ghost's target at the edge of the board in
+    // ghostDirection_, if it is chasing or scattering.
+    void steerGhost(Actor *ghost, int *targetTileX, int *targetTileY);
+
+    // Simulation initialisation success.
+    bool success_;
+
+    // How many ticks make up one second of game time.
+    int ticksPerSecond_;
+    
+    // For frightened ghosts.
+    uint32_t seed_;
+    Random random_;
+
+    // Data structures for running our simulation.
+    Board board_;
+    TileExits tileExits_;
+    Actor *pacman_;
+    Actor **ghosts_;
+    int numGhosts_;
+    OccupancyGrid occupancy_; // Which ghosts are in which tile, by index.
+    int controlledGhost_;     // Steered by a player, -1 if none.
+    Direction ghostDirection_; // Where the player wants it to go on this tick.
+    int baseEntranceX_;       // Tile right outside the gates of the home
+    int baseEntranceY_;       // base, where Blinky starts.
+    int baseSpotX_;           // Where Pinky waits in the base, in pixels,
+    int baseSpotY_;           // which eaten ghosts line up with going home.
+    int *modes_;           // How long to stay in each mode:
+    int currentModeIndex_; // Even indices is Scatter mode,
+                           // Odd indices is Chase mode.
+    bool isModeTimerRunning_;
+    int modeTicks_;        // How many ticks have passed in current mode.
+
+    // Member variables for running our simulation.
+    bool currentMode_;     // The current mode all out-of-base alive
+                           // ghosts should be in on this tick.
+                           // false is Scatter mode,
+                           // true is Chase mode.
+    int boardWidth_;
+    int boardHeight_;
+    int pellets_;
+    int totalPellets_;
+    int boardVersion_;
+    bool isGameOver_;
+    bool isGameOverWin_;
+    int portalOneX;
+    int portalOneY;
+    int portalTwoX;
+    int portalTwoY;
+    int tunnelOneEndX_;    // Last tile of the tunnel from portal one,
+    int tunnelTwoEndX_;    // and from portal two, on the portals' row.
+    
+    // Speeds in sub-pixels per tick.
+    int pacmanSpeed_;
+    int pacmanPowerSpeed_;
+    int ghostTunnelSpeed_;
+    int ghostSpeeds_[NUM_GHOST_STATES];
+
+    // For animations.
+    int pacmanAnimationFrame_;
+    int pacmanAnimationFrameCounter_;
+    int pelletAnimationFrame_;
+    int pelletAnimationFrameCounter_;
+    bool isFrightenedFlashing_;
+};
+
+#endif /* simulation_h */
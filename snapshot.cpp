@@ -0,0 +1,37 @@
+#include "snapshot.h"
+#include "simulation.h"
+
+void takeSnapshot(Simulation *simulation, Snapshot *snapshot)
+{
+  int numGhosts = simulation->getNumGhosts();
+  for (int i = -1; i < numGhosts; i++) {
+    Actor *from = (i == -1) ? simulation->getPacman() : simulation->getGhost(i);
+    ActorSnapshot *actor = (i == -1) ? &snapshot->pacman : &snapshot->ghosts[i];
+    actor->x = from->getX();
+    actor->y = from->getY();
+    actor->direction = from->getDirection();
+    actor->state = from->getState();
+    actor->targetTileX = from->getTargetTileX();
+    actor->targetTileY = from->getTargetTileY();
+  }
+  snapshot->pacmanAnimationFrame = simulation->getPacmanAnimationFrame();
+  snapshot->pelletAnimationFrame = simulation->getPelletAnimationFrame();
+  snapshot->isFrightenedFlashing = simulation->isFrightenedFlashing();
+  snapshot->isGameOver = simulation->isGameOver();
+  snapshot->isGameOverWin = simulation->isGameOverWin();
+  snapshot->inputTime = 0; // Filled in by Game, which reads the input.
+  
+  // The board only changes when a pellet is eaten, so this snapshot's
+  // copy of it usually still holds.
+  int boardWidth = simulation->getBoardWidth();
+  int boardHeight = simulation->getBoardHeight();
+  int boardVersion = simulation->getBoardVersion();
+  if (snapshot->boardVersion != boardVersion) {
+    for (int y = 0; y < boardHeight; y++) {
+      for (int x = 0; x < boardWidth; x++) {
+        snapshot->tiles[(y * boardWidth) + x] = (uint8_t)simulation->getTile(x, y);
+      }
+    }
+    snapshot->boardVersion = boardVersion;
+  }
+}
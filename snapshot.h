@@ -0,0 +1,52 @@
+#ifndef snapshot_h
+#define snapshot_h
+
+#include <stdint.h>
+#include "actor.h"
+#include "direction.h"
+#include "tile.h"
+
+// What is drawn of one actor.
+struct ActorSnapshot {
+  int x;                 // Pixel coords of the top left corner.
+  int y;
+  Direction direction;
+  GHOST_STATE state;
+  int targetTileX;       // Only drawn for ghosts.
+  int targetTileY;
+};
+
+/**
+ * Everything Game draws of one tick of its simulation, copied out so the
+ * simulation can move on to the next tick on its own thread while this
+ * one is drawn on the render thread.
+ */
+struct Snapshot {
+  uint64_t tick;                          // Ticks stepped before this one.
+  ActorSnapshot pacman;
+  ActorSnapshot *ghosts;                  // One per ghost, as numbered by
+                                          // the simulation.
+  int pacmanAnimationFrame;
+  int pelletAnimationFrame;
+  bool isFrightenedFlashing;
+  bool isGameOver;
+  bool isGameOverWin;
+  uint64_t inputTime;                     // When the key of the newest input
+                                          // used by this tick or before went
+                                          // down, by Game's clock, or 0.
+
+  // Board width x board height, row by row. Only copied again when
+  // the simulation's getBoardVersion() has moved on from boardVersion.
+  uint8_t *tiles;                         // TileTypes.
+  int boardVersion;                       // -1 until first copied.
+};
+
+class Simulation;
+
+/**
+ * Copy what is drawn of simulation into snapshot, whose ghosts and tiles
+ * are already allocated for the simulation's ghosts and board.
+ */
+void takeSnapshot(Simulation *simulation, Snapshot *snapshot);
+
+#endif /* snapshot_h */
@@ -0,0 +1,120 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "spritebatch.h"
+
+SpriteBatch::SpriteBatch()
+{
+  texture_ = NULL;
+  textureWidth_ = 0;
+  textureHeight_ = 0;
+  vertices_ = NULL;
+  indices_ = NULL;
+  numSprites_ = 0;
+  capacity_ = 0;
+}
+
+SpriteBatch::~SpriteBatch()
+{
+  if (vertices_ != NULL) free(vertices_);
+  if (indices_ != NULL) free(indices_);
+}
+
+bool SpriteBatch::init(SDL_Texture *texture)
+{
+  int width = 0;
+  int height = 0;
+  if (SDL_QueryTexture(texture, NULL, NULL, &width, &height) != 0) {
+    printf("Failed to query sprite batch texture! SDL Error: %s\n", SDL_GetError());
+    return false;
+  }
+  texture_ = texture;
+  textureWidth_ = (float)width;
+  textureHeight_ = (float)height;
+  numSprites_ = 0;
+  return reserve(INITIAL_CAPACITY);
+}
+
+bool SpriteBatch::reserve(int numSprites)
+{
+  if (numSprites <= capacity_) {
+    return true;
+  }
+  
+  SDL_Vertex *vertices = (SDL_Vertex *)realloc(vertices_, numSprites * 4 * sizeof(SDL_Vertex));
+  if (vertices == NULL) {
+    printf("Failed to allocate memory for sprite batch vertices!\n");
+    return false;
+  }
+  vertices_ = vertices;
+  
+  int *indices = (int *)realloc(indices_, numSprites * 6 * sizeof(int));
+  if (indices == NULL) {
+    printf("Failed to allocate memory for sprite batch indices!\n");
+    return false;
+  }
+  indices_ = indices;
+  
+  // Every sprite is the same two triangles over its four corners,
+  // so the indices only ever need filling in once.
+  for (int i = capacity_; i < numSprites; i++) {
+    int corner = i * 4;
+    indices_[(i * 6) + 0] = corner + 0;
+    indices_[(i * 6) + 1] = corner + 1;
+    indices_[(i * 6) + 2] = corner + 2;
+    indices_[(i * 6) + 3] = corner + 2;
+    indices_[(i * 6) + 4] = corner + 3;
+    indices_[(i * 6) + 5] = corner + 0;
+  }
+  capacity_ = numSprites;
+  return true;
+}
+
+bool SpriteBatch::add(SDL_Rect *clip, int x, int y)
+{
+  if (numSprites_ == capacity_ && !reserve(capacity_ * 2)) {
+    return false;
+  }
+  
+  // Corners of the sprite on screen, clockwise from top left.
+  float left = (float)x;
+  float right = (float)(x + clip->w);
+  float top = (float)y;
+  float bot = (float)(y + clip->h);
+  float positionsX[4] = { left, right, right, left };
+  float positionsY[4] = { top, top, bot, bot };
+  
+  // Texture coordinates of the clip's corners, in the same order.
+  float textureLeft = clip->x / textureWidth_;
+  float textureRight = (clip->x + clip->w) / textureWidth_;
+  float textureTop = clip->y / textureHeight_;
+  float textureBot = (clip->y + clip->h) / textureHeight_;
+  float texturesX[4] = { textureLeft, textureRight, textureRight, textureLeft };
+  float texturesY[4] = { textureTop, textureTop, textureBot, textureBot };
+  
+  SDL_Vertex *vertex = &vertices_[numSprites_ * 4];
+  for (int i = 0; i < 4; i++) {
+    vertex[i].position.x = positionsX[i];
+    vertex[i].position.y = positionsY[i];
+    vertex[i].color = { .r = 0xFF, .g = 0xFF, .b = 0xFF, .a = 0xFF };
+    vertex[i].tex_coord.x = texturesX[i];
+    vertex[i].tex_coord.y = texturesY[i];
+  }
+  numSprites_++;
+  return true;
+}
+
+bool SpriteBatch::flush(SDL_Renderer *renderer)
+{
+  if (numSprites_ == 0) {
+    return true;
+  }
+  
+  bool success = true;
+  if (SDL_RenderGeometry(renderer, texture_, vertices_, numSprites_ * 4, indices_, numSprites_ * 6) != 0) {
+    printf("Failed to render sprite batch of %d sprites! SDL Error: %s\n",
+           numSprites_, SDL_GetError());
+    success = false;
+  }
+  numSprites_ = 0;
+  return success;
+}
@@ -0,0 +1,56 @@
+#ifndef spritebatch_h
+#define spritebatch_h
+
+#include <SDL2/SDL.h>
+
+/**
+ * Collects the sprites drawn from one texture over a frame into a
+ * vertex/index buffer, and submits them all with a single
+ * SDL_RenderGeometry call, instead of one SDL_RenderCopyEx per sprite.
+ *
+ * The buffers are kept between frames, and only grow (which allocates)
+ * the first time a frame draws more sprites than ever before.
+ */
+class SpriteBatch {
+  public:
+    SpriteBatch();
+    ~SpriteBatch();
+    
+    /**
+     * Use the given texture for all sprites in this batch.
+     * \Returns false if unable to allocate the buffers.
+     */
+    bool init(SDL_Texture *texture);
+    
+    /**
+     * Queue the sprite at clip on the texture to be drawn at (x,y) on
+     * screen. Sprites are drawn as they are in the texture, so any turned
+     * ones need to be turned in it already (see atlasgen).
+     */
+    bool add(SDL_Rect *clip, int x, int y);
+    
+    /**
+     * Draw every queued sprite, in the order they were queued, and empty
+     * the batch. Must be called before drawing anything not in this batch,
+     * and before changing render target or clip rect.
+     */
+    bool flush(SDL_Renderer *renderer);
+    
+  private:
+    // Make room for at least the given number of sprites.
+    bool reserve(int numSprites);
+    
+    SDL_Texture *texture_;
+    float textureWidth_;
+    float textureHeight_;
+    
+    // Four vertices and six indices per sprite.
+    SDL_Vertex *vertices_;
+    int *indices_;
+    int numSprites_;
+    int capacity_;
+    
+    static const int INITIAL_CAPACITY = 2048;
+};
+
+#endif /* spritebatch_h */
@@ -0,0 +1,96 @@
+// Generated by atlasgen from spritesheet.png. Do not edit.
+
+#ifndef sprites_h
+#define sprites_h
+
+#include <stdint.h>
+
+// Every sprite in the atlas.
+typedef enum {
+  SPRITE_PACMAN_STILL,
+  SPRITE_PACMAN_UP_0,
+  SPRITE_PACMAN_DOWN_0,
+  SPRITE_PACMAN_LEFT_0,
+  SPRITE_PACMAN_RIGHT_0,
+  SPRITE_PACMAN_UP_1,
+  SPRITE_PACMAN_DOWN_1,
+  SPRITE_PACMAN_LEFT_1,
+  SPRITE_PACMAN_RIGHT_1,
+  SPRITE_GHOST_BLINKY,
+  SPRITE_GHOST_INKY,
+  SPRITE_GHOST_PINKY,
+  SPRITE_GHOST_CLYDE,
+  SPRITE_GHOST_FRIGHTENED,
+  SPRITE_GHOST_FRIGHTENED_FLASH,
+  SPRITE_EYES_UP,
+  SPRITE_EYES_DOWN,
+  SPRITE_EYES_LEFT,
+  SPRITE_EYES_RIGHT,
+  SPRITE_TARGET_BLINKY,
+  SPRITE_TARGET_INKY,
+  SPRITE_TARGET_PINKY,
+  SPRITE_TARGET_CLYDE,
+  SPRITE_PELLET,
+  SPRITE_POWER_PELLET_0,
+  SPRITE_POWER_PELLET_1,
+  SPRITE_GATE,
+  SPRITE_WALL_TOP_LEFT,
+  SPRITE_WALL_TOP_RIGHT,
+  SPRITE_WALL_BOT_LEFT,
+  SPRITE_WALL_BOT_RIGHT,
+  SPRITE_WALL_LEFT_RIGHT,
+  SPRITE_WALL_TOP_BOT,
+  NUM_SPRITES
+} SpriteId;
+
+struct SpriteRect {
+  int x;
+  int y;
+  int w;
+  int h;
+};
+
+constexpr int ATLAS_WIDTH = 384;
+constexpr int ATLAS_HEIGHT = 168;
+
+// Where each sprite is in the atlas, by SpriteId.
+constexpr SpriteRect SPRITE_RECTS[NUM_SPRITES] = {
+  { 0, 0, 48, 48 }, // SPRITE_PACMAN_STILL
+  { 48, 0, 48, 48 }, // SPRITE_PACMAN_UP_0
+  { 96, 0, 48, 48 }, // SPRITE_PACMAN_DOWN_0
+  { 144, 0, 48, 48 }, // SPRITE_PACMAN_LEFT_0
+  { 192, 0, 48, 48 }, // SPRITE_PACMAN_RIGHT_0
+  { 240, 0, 48, 48 }, // SPRITE_PACMAN_UP_1
+  { 288, 0, 48, 48 }, // SPRITE_PACMAN_DOWN_1
+  { 336, 0, 48, 48 }, // SPRITE_PACMAN_LEFT_1
+  { 0, 48, 48, 48 }, // SPRITE_PACMAN_RIGHT_1
+  { 48, 48, 48, 48 }, // SPRITE_GHOST_BLINKY
+  { 96, 48, 48, 48 }, // SPRITE_GHOST_INKY
+  { 144, 48, 48, 48 }, // SPRITE_GHOST_PINKY
+  { 192, 48, 48, 48 }, // SPRITE_GHOST_CLYDE
+  { 240, 48, 48, 48 }, // SPRITE_GHOST_FRIGHTENED
+  { 288, 48, 48, 48 }, // SPRITE_GHOST_FRIGHTENED_FLASH
+  { 336, 48, 48, 48 }, // SPRITE_EYES_UP
+  { 0, 96, 48, 48 }, // SPRITE_EYES_DOWN
+  { 48, 96, 48, 48 }, // SPRITE_EYES_LEFT
+  { 96, 96, 48, 48 }, // SPRITE_EYES_RIGHT
+  { 144, 96, 24, 24 }, // SPRITE_TARGET_BLINKY
+  { 168, 96, 24, 24 }, // SPRITE_TARGET_INKY
+  { 192, 96, 24, 24 }, // SPRITE_TARGET_PINKY
+  { 216, 96, 24, 24 }, // SPRITE_TARGET_CLYDE
+  { 240, 96, 24, 24 }, // SPRITE_PELLET
+  { 264, 96, 24, 24 }, // SPRITE_POWER_PELLET_0
+  { 288, 96, 24, 24 }, // SPRITE_POWER_PELLET_1
+  { 312, 96, 24, 24 }, // SPRITE_GATE
+  { 336, 96, 24, 24 }, // SPRITE_WALL_TOP_LEFT
+  { 360, 96, 24, 24 }, // SPRITE_WALL_TOP_RIGHT
+  { 0, 144, 24, 24 }, // SPRITE_WALL_BOT_LEFT
+  { 24, 144, 24, 24 }, // SPRITE_WALL_BOT_RIGHT
+  { 48, 144, 24, 24 }, // SPRITE_WALL_LEFT_RIGHT
+  { 72, 144, 24, 24 }  // SPRITE_WALL_TOP_BOT
+};
+
+// The atlas, row by row, as SDL_PIXELFORMAT_RGBA8888.
+extern const uint32_t ATLAS_PIXELS[ATLAS_WIDTH * ATLAS_HEIGHT];
+
+#endif /* sprites_h */
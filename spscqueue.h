@@ -0,0 +1,91 @@
+#ifndef spscqueue_h
+#define spscqueue_h
+
+#include <atomic>
+
+/**
+ * Hands every one of a stream of values, in order, from one writer
+ * thread to one reader thread, through a fixed ring of CAPACITY slots,
+ * with no locks and no allocation.
+ *
+ * Values are built in place: the writer fills in the slot from
+ * getBack() and pushes it, and the reader reads the slot from
+ * getFront() and pops it, so slots can own buffers set up once before
+ * either thread starts (see getBuffer()). Unlike TripleBuffer, nothing is
+ * skipped, so when the ring is full the writer has to wait for the
+ * reader, or drop the value itself.
+ *
+ * Each side only writes its own count of slots pushed or popped, and
+ * reads the other's to see how far it can go.
+ */
+template <typename T, int CAPACITY>
+class SpscQueue {
+  static_assert((CAPACITY & (CAPACITY - 1)) == 0, "CAPACITY must be a power of two");
+
+  public:
+    SpscQueue()
+    {
+      pushed_.store(0, std::memory_order_relaxed);
+      popped_.store(0, std::memory_order_relaxed);
+    }
+
+    /**
+     * For setting up each slot (e.g. allocating what it points to)
+     * before either thread starts using them.
+     */
+    T *getBuffer(int i)
+    {
+      return &slots_[i];
+    }
+
+    static const int NUM_BUFFERS = CAPACITY;
+
+    /* Writer. */
+
+    /**
+     * The next slot to fill in, or NULL if the ring is full. Holds
+     * whatever was pushed into it CAPACITY values ago.
+     */
+    T *getBack()
+    {
+      unsigned pushed = pushed_.load(std::memory_order_relaxed);
+      if (pushed - popped_.load(std::memory_order_acquire) == CAPACITY) {
+        return NULL;
+      }
+      return &slots_[pushed % CAPACITY];
+    }
+
+    // Hand the slot from getBack() over to the reader.
+    void push()
+    {
+      pushed_.store(pushed_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    /* Reader. */
+
+    // The oldest slot pushed and not yet popped, or NULL if none.
+    T *getFront()
+    {
+      unsigned popped = popped_.load(std::memory_order_relaxed);
+      if (pushed_.load(std::memory_order_acquire) == popped) {
+        return NULL;
+      }
+      return &slots_[popped % CAPACITY];
+    }
+
+    // Hand the slot from getFront() back to the writer.
+    void pop()
+    {
+      popped_.store(popped_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+  private:
+    T slots_[CAPACITY];
+
+    // Counts, wrapping around, which is why CAPACITY is a power of two.
+    // Each on its own cache line, as each is only written by one thread.
+    alignas(64) std::atomic<unsigned> pushed_;  // Writer's.
+    alignas(64) std::atomic<unsigned> popped_;  // Reader's.
+};
+
+#endif /* spscqueue_h */
@@ -0,0 +1,141 @@
+#ifndef targeting_h
+#define targeting_h
+
+#include "actor.h"
+#include "direction.h"
+
+/**
+ * Which tile each kind of ghost heads for, as policy types put together
+ * at compile time, so each ghost's target is worked out with no branches
+ * on which ghost it is, and can be inlined into the loop moving it.
+ *
+ * A ghost's targeting is made of three rules: where it heads in Chase
+ * mode, where it heads in Scatter mode, and where it heads to get home
+ * to the base (when eaten, or leaving the base again). Each rule is a
+ * type with a static find() taking TargetInputs. To add a personality,
+ * put together a GhostTargeting from new or existing rules.
+ *
+ * The rules are plain arithmetic on ints, so BatchSimulation can use the
+ * same ones in its vectorized target pass.
+ */
+
+// Everything targeting rules need to know, all in tile space.
+struct TargetInputs {
+  int state;               // GHOST_STATE of the ghost.
+  int tileX;               // Tile the ghost is in.
+  int tileY;
+  int pacmanTileX;
+  int pacmanTileY;
+  int pacmanAheadX;        // One tile in the direction PACMAN faces,
+  int pacmanAheadY;        // or 0, 0 before PACMAN starts moving.
+  int partnerTileX;        // Tile of the Blinky of the ghost's group,
+  int partnerTileY;        // for ghosts that work together.
+  int scatterTileX;        // The ghost's corner.
+  int scatterTileY;
+  int homeTileX;           // Right outside the gates of the base.
+  int homeTileY;
+  int spotTileX;           // The ghost's spot inside the base.
+  int spotTileY;
+};
+
+// Set ahead to one tile in the given direction.
+inline void getAhead(int direction, int *aheadX, int *aheadY)
+{
+  *aheadX = (direction == DIRECTION_RIGHT) - (direction == DIRECTION_LEFT);
+  *aheadY = (direction == DIRECTION_DOWN) - (direction == DIRECTION_UP);
+}
+
+/* Chase rules. */
+
+// Directly where PACMAN is. Blinky.
+struct ChasePacman {
+  static void find(const TargetInputs &in, int *x, int *y)
+  {
+    *x = in.pacmanTileX;
+    *y = in.pacmanTileY;
+  }
+};
+
+// The given number of tiles in front of PACMAN. Pinky, four tiles.
+template <int TILES>
+struct ChaseAheadOfPacman {
+  static void find(const TargetInputs &in, int *x, int *y)
+  {
+    *x = in.pacmanTileX + (TILES * in.pacmanAheadX);
+    *y = in.pacmanTileY + (TILES * in.pacmanAheadY);
+  }
+};
+
+// Flank PACMAN with the partner: the tile the given number of tiles in
+// front of PACMAN is half way between the partner and the target. Inky.
+template <int TILES>
+struct ChaseFlankingPartner {
+  static void find(const TargetInputs &in, int *x, int *y)
+  {
+    *x = (2 * (in.pacmanTileX + (TILES * in.pacmanAheadX))) - in.partnerTileX;
+    *y = (2 * (in.pacmanTileY + (TILES * in.pacmanAheadY))) - in.partnerTileY;
+  }
+};
+
+// PACMAN, until within the given number of tiles of PACMAN, then run off
+// into the ghost's corner. Clyde, eight tiles.
+template <int TILES>
+struct ChaseUntilClose {
+  static void find(const TargetInputs &in, int *x, int *y)
+  {
+    int distanceX = in.tileX - in.pacmanTileX;
+    int distanceY = in.tileY - in.pacmanTileY;
+    bool isFar = (distanceX * distanceX) + (distanceY * distanceY) >= TILES * TILES;
+    *x = isFar ? in.pacmanTileX : in.scatterTileX;
+    *y = isFar ? in.pacmanTileY : in.scatterTileY;
+  }
+};
+
+/* Scatter rules. */
+
+// The ghost's own corner, from the level.
+struct ScatterToCorner {
+  static void find(const TargetInputs &in, int *x, int *y)
+  {
+    *x = in.scatterTileX;
+    *y = in.scatterTileY;
+  }
+};
+
+/* Home rules, for every state but Chase and Scatter. */
+
+// Through the gates of the base to the ghost's spot, and back out.
+// Nowhere in particular while frightened or waiting.
+struct HomeThroughGates {
+  static void find(const TargetInputs &in, int *x, int *y)
+  {
+    bool isGates = (in.state == GHOST_EATEN || in.state == GHOST_FINDING_EXIT);
+    bool isSpot = (in.state == GHOST_FINDING_SPOT);
+    *x = isGates ? in.homeTileX : isSpot ? in.spotTileX : -1;
+    *y = isGates ? in.homeTileY : isSpot ? in.spotTileY : -1;
+  }
+};
+
+/**
+ * Targeting of one kind of ghost, from a chase rule, a scatter rule and
+ * a home rule, choosing between them by the ghost's state.
+ */
+template <typename Chase, typename Scatter = ScatterToCorner, typename Home = HomeThroughGates>
+struct GhostTargeting {
+  static void find(const TargetInputs &in, int *x, int *y)
+  {
+    int chaseX, chaseY, scatterX, scatterY, homeX, homeY;
+    Chase::find(in, &chaseX, &chaseY);
+    Scatter::find(in, &scatterX, &scatterY);
+    Home::find(in, &homeX, &homeY);
+    *x = (in.state == GHOST_CHASE) ? chaseX : (in.state == GHOST_SCATTER) ? scatterX : homeX;
+    *y = (in.state == GHOST_CHASE) ? chaseY : (in.state == GHOST_SCATTER) ? scatterY : homeY;
+  }
+};
+
+typedef GhostTargeting<ChasePacman> BlinkyTargeting;
+typedef GhostTargeting<ChaseFlankingPartner<2> > InkyTargeting;
+typedef GhostTargeting<ChaseAheadOfPacman<4> > PinkyTargeting;
+typedef GhostTargeting<ChaseUntilClose<8> > ClydeTargeting;
+
+#endif /* targeting_h */
@@ -0,0 +1,141 @@
+#include <stddef.h>
+#include "threadpool.h"
+
+ThreadPool::ThreadPool(int numThreads)
+{
+  if (numThreads <= 0) {
+    numThreads = (int)std::thread::hardware_concurrency();
+    // Unknown core count.
+    if (numThreads <= 0) numThreads = 1;
+  }
+  numThreads_ = numThreads;
+  task_ = NULL;
+  arg_ = NULL;
+  job_ = 0;
+  numBusy_ = 0;
+  isStopping_ = false;
+
+  ranges_ = new Range[numThreads_];
+  for (int i = 0; i < numThreads_; i++) {
+    ranges_[i].begin = 0;
+    ranges_[i].end = 0;
+  }
+  threads_ = new std::thread[numThreads_ - 1];
+  for (int i = 1; i < numThreads_; i++) {
+    threads_[i - 1] = std::thread(&ThreadPool::workerLoop, this, i);
+  }
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    isStopping_ = true;
+  }
+  wake_.notify_all();
+  for (int i = 0; i < numThreads_ - 1; i++) threads_[i].join();
+  delete[] threads_;
+  delete[] ranges_;
+}
+
+int ThreadPool::getNumThreads()
+{
+  return numThreads_;
+}
+
+void ThreadPool::run(int numTasks, void (*task)(void *arg, int index, int thread), void *arg)
+{
+  if (numTasks <= 0) return;
+
+  // Deal out the tasks. No worker is busy, so no locking needed.
+  for (int i = 0; i < numThreads_; i++) {
+    ranges_[i].begin = (int)(((long long)numTasks * i) / numThreads_);
+    ranges_[i].end = (int)(((long long)numTasks * (i + 1)) / numThreads_);
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    task_ = task;
+    arg_ = arg;
+    numBusy_ = numThreads_ - 1;
+    job_++;
+  }
+  wake_.notify_all();
+
+  work(0);
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  done_.wait(lock, [this] { return numBusy_ == 0; });
+}
+
+void ThreadPool::workerLoop(int thread)
+{
+  int lastJob = 0;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      wake_.wait(lock, [this, lastJob] { return isStopping_ || job_ != lastJob; });
+      if (isStopping_) return;
+      lastJob = job_;
+    }
+
+    work(thread);
+
+    bool isLast;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      numBusy_--;
+      isLast = (numBusy_ == 0);
+    }
+    if (isLast) done_.notify_one();
+  }
+}
+
+void ThreadPool::work(int thread)
+{
+  int index;
+  while (true) {
+    if (!takeTask(thread, &index)) {
+      if (!stealTasks(thread)) break;
+      continue;
+    }
+    task_(arg_, index, thread);
+  }
+}
+
+bool ThreadPool::takeTask(int thread, int *index)
+{
+  Range *range = &ranges_[thread];
+  std::lock_guard<std::mutex> lock(range->mutex);
+  if (range->begin >= range->end) return false;
+  *index = range->begin++;
+  return true;
+}
+
+bool ThreadPool::stealTasks(int thread)
+{
+  // Start with the next thread along, so thieves spread out over victims.
+  for (int i = 1; i < numThreads_; i++) {
+    Range *victim = &ranges_[(thread + i) % numThreads_];
+    int begin;
+    int end;
+    {
+      std::lock_guard<std::mutex> lock(victim->mutex);
+      int remaining = victim->end - victim->begin;
+      if (remaining <= 0) continue;
+      // Take the back half, rounding up so a last task can be taken.
+      end = victim->end;
+      begin = end - ((remaining + 1) / 2);
+      victim->end = begin;
+    }
+    // Our range is empty, and only we ever fill it.
+    Range *range = &ranges_[thread];
+    std::lock_guard<std::mutex> lock(range->mutex);
+    range->begin = begin;
+    range->end = end;
+    return true;
+  }
+  // Every range is empty. Tasks may still be running, but
+  // no new ones will appear, so this thread is done.
+  return false;
+}
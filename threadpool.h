@@ -0,0 +1,72 @@
+#ifndef threadpool_h
+#define threadpool_h
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+/**
+ * A fixed set of threads for running many independent tasks, such as
+ * headless games, on every core.
+ *
+ * Each call of run() deals the task indices out evenly, as one range per
+ * thread. A thread works through its own range from the front, and once
+ * it runs dry steals the back half of whichever other range it finds
+ * first still holding work. Tasks that take very different times (short
+ * and long games) so still keep every thread busy until the very end,
+ * without threads fighting over one shared queue for every task.
+ */
+class ThreadPool {
+  public:
+    /**
+     * Start numThreads threads, counting the thread calling run(),
+     * or one per core if numThreads is 0 or less.
+     */
+    ThreadPool(int numThreads = 0);
+    ~ThreadPool();
+
+    int getNumThreads();
+
+    /**
+     * Call task(arg, index, thread) once for every index from 0 to
+     * numTasks - 1, spread over every thread, returning once all calls
+     * have returned. thread is from 0 to getNumThreads() - 1, and no two
+     * calls with the same thread run at once, so it can pick out scratch
+     * space for the task to use.
+     */
+    void run(int numTasks, void (*task)(void *arg, int index, int thread), void *arg);
+
+  private:
+    // Task indices from begin up to end are waiting to be run. On its
+    // own cache line, as other threads only touch it when stealing.
+    struct alignas(64) Range {
+      std::mutex mutex;
+      int begin;
+      int end;
+    };
+
+    void workerLoop(int thread);
+
+    // Run tasks until there are none left in any range.
+    void work(int thread);
+    bool takeTask(int thread, int *index);
+    bool stealTasks(int thread);
+
+    int numThreads_;
+    std::thread *threads_;  // numThreads_ - 1 of them, as the thread
+                            // calling run() works too.
+    Range *ranges_;
+
+    // Current job, changed by run() only while no workers are busy.
+    void (*task_)(void *arg, int index, int thread);
+    void *arg_;
+
+    std::mutex mutex_;
+    std::condition_variable wake_;  // A new job, or stopping.
+    std::condition_variable done_;  // The last busy worker finished.
+    int job_;                       // Counts calls of run().
+    int numBusy_;                   // Workers still working on this job.
+    bool isStopping_;
+};
+
+#endif /* threadpool_h */
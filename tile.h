@@ -0,0 +1,14 @@
+#ifndef tile_h
+#define tile_h
+
+typedef enum {
+  TILE_NONE,
+  TILE_WALL,
+  TILE_PELLET,
+  TILE_POWER_PELLET,
+  TILE_PORTAL,
+  TILE_BASE,
+  TILE_GATE
+} TileType;
+
+#endif /* tile_h */
@@ -0,0 +1,95 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "tileexits.h"
+
+// Tile offsets for each Direction, indexed by Direction.
+static const int DX[5] = { 0, 0, 0, -1, 1 };
+static const int DY[5] = { 0, -1, 1, 0, 0 };
+
+Direction getOppositeDirection(Direction direction)
+{
+  switch (direction) {
+    case DIRECTION_UP: return DIRECTION_DOWN;
+    case DIRECTION_DOWN: return DIRECTION_UP;
+    case DIRECTION_LEFT: return DIRECTION_RIGHT;
+    case DIRECTION_RIGHT: return DIRECTION_LEFT;
+    default: return DIRECTION_NONE;
+  }
+}
+
+int rankDirections(int tileX, int tileY, int directions,
+                   int targetTileX, int targetTileY, Direction *ranked)
+{
+  int distances[4];
+  int numRanked = 0;
+  for (int d = DIRECTION_UP; d <= DIRECTION_RIGHT; d++) {
+    if (!(directions & getDirectionBit((Direction)d))) continue;
+    // Squared distance orders the same as distance.
+    int distanceX = tileX + DX[d] - targetTileX;
+    int distanceY = tileY + DY[d] - targetTileY;
+    int distance = (distanceX * distanceX) + (distanceY * distanceY);
+    // Insert after any direction as close, so ties go up, down, left, right.
+    int i = numRanked;
+    while (i > 0 && distances[i - 1] > distance) {
+      distances[i] = distances[i - 1];
+      ranked[i] = ranked[i - 1];
+      i--;
+    }
+    distances[i] = distance;
+    ranked[i] = (Direction)d;
+    numRanked++;
+  }
+  return numRanked;
+}
+
+Direction getOnlyDirection(int directions)
+{
+  for (int d = DIRECTION_UP; d < DIRECTION_RIGHT; d++) {
+    if (directions & getDirectionBit((Direction)d)) return (Direction)d;
+  }
+  return DIRECTION_RIGHT;
+}
+
+
+TileExits::TileExits()
+{
+  width_ = 0;
+  height_ = 0;
+  exits_ = NULL;
+}
+
+TileExits::~TileExits()
+{
+  if (exits_ != NULL) free(exits_);
+}
+
+bool TileExits::init(Board *board)
+{
+  width_ = board->getWidth();
+  height_ = board->getHeight();
+
+  if (exits_ != NULL) free(exits_);
+  exits_ = (uint8_t *)malloc(width_ * height_ * sizeof(uint8_t));
+  if (exits_ == NULL) {
+    printf("Failed to allocate memory for tile exits!\n");
+    return false;
+  }
+
+  for (int y = 0; y < height_; y++) {
+    for (int x = 0; x < width_; x++) {
+      int exits = 0;
+      TileType tile = board->getTile(x, y);
+      if (tile != TILE_WALL && tile != TILE_GATE) {
+        for (int d = DIRECTION_UP; d <= DIRECTION_RIGHT; d++) {
+          // Tiles beyond the edge of the board are walls.
+          TileType adjacentTile = board->getTile(x + DX[d], y + DY[d]);
+          if (adjacentTile != TILE_WALL && adjacentTile != TILE_GATE) {
+            exits |= getDirectionBit((Direction)d);
+          }
+        }
+      }
+      exits_[(y * width_) + x] = (uint8_t)exits;
+    }
+  }
+  return true;
+}
@@ -0,0 +1,62 @@
+#ifndef tileexits_h
+#define tileexits_h
+
+#include <stdint.h>
+#include "board.h"
+#include "direction.h"
+
+// Bit for the given direction in an exit mask.
+inline int getDirectionBit(Direction direction)
+{
+  return 1 << direction;
+}
+
+Direction getOppositeDirection(Direction direction);
+
+/**
+ * Sort the given mask of directions out of a tile by how close the
+ * tile each leads to is to the target tile, closest first.
+ * \Returns how many directions were written to ranked.
+ */
+int rankDirections(int tileX, int tileY, int directions,
+                   int targetTileX, int targetTileY, Direction *ranked);
+
+/**
+ * The only direction in a mask with exactly one direction in it.
+ */
+Direction getOnlyDirection(int directions);
+
+/**
+ * Which ways each tile of the board can be left by, for ghosts outside
+ * of the base (gates count as walls).
+ *
+ * A ghost never turns straight back, so it only ranks directions by its
+ * target in a tile where, after ruling out turning back, more than one
+ * exit remains. Anywhere else, in a corridor or round a corner, it takes
+ * the one exit left.
+ */
+class TileExits {
+  public:
+    TileExits();
+    ~TileExits();
+
+    /**
+     * Work out the exits of every tile of the given board.
+     * \Returns false if unable to allocate them.
+     */
+    bool init(Board *board);
+
+    // Mask of getDirectionBit() for each neighbouring tile a ghost can
+    // walk into from this tile. Tile must be on the board.
+    int getExits(int tileX, int tileY)
+    {
+      return exits_[(tileY * width_) + tileX];
+    }
+
+  private:
+    int width_;
+    int height_;
+    uint8_t *exits_;
+};
+
+#endif /* tileexits_h */
@@ -0,0 +1,90 @@
+#ifndef triplebuffer_h
+#define triplebuffer_h
+
+#include <atomic>
+
+/**
+ * Hands the newest of a stream of values from one writer thread to one
+ * reader thread, without either ever waiting on the other.
+ *
+ * There are three buffers: the writer's, the reader's, and a spare in the
+ * middle. The writer fills in its buffer and publishes it by swapping it
+ * with the middle one. The reader takes the newest value by swapping its
+ * buffer with the middle one, if that was published since it last looked.
+ * Values published in between are skipped, never queued up.
+ *
+ * Only the index of the middle buffer is shared. The writer's and
+ * reader's buffers are theirs alone until they swap them away.
+ */
+template <typename T>
+class TripleBuffer {
+  public:
+    TripleBuffer()
+    {
+      back_ = 0;
+      middle_.store(1, std::memory_order_relaxed);
+      front_ = 2;
+    }
+
+    /**
+     * For setting up each buffer (e.g. allocating what it points to)
+     * before either thread starts using them.
+     */
+    T *getBuffer(int i)
+    {
+      return &buffers_[i];
+    }
+
+    static const int NUM_BUFFERS = 3;
+
+    /* Writer. */
+
+    // The buffer to fill in. Holds whatever was published three values
+    // ago, or one skipped by the reader, so needs filling in entirely.
+    T *getBack()
+    {
+      return &buffers_[back_];
+    }
+
+    // Make the back buffer the newest value, and take another to fill in.
+    void publish()
+    {
+      back_ = middle_.exchange(back_ | FRESH, std::memory_order_acq_rel) & INDEX_MASK;
+    }
+
+    /* Reader. */
+
+    /**
+     * Take the newest value published, if there is one we haven't taken.
+     * \Returns false if nothing was published since last time.
+     */
+    bool update()
+    {
+      if ((middle_.load(std::memory_order_relaxed) & FRESH) == 0) {
+        return false;
+      }
+      front_ = middle_.exchange(front_, std::memory_order_acq_rel) & INDEX_MASK;
+      return true;
+    }
+
+    // The newest value taken by update(). Stays put until the next update().
+    const T *getFront()
+    {
+      return &buffers_[front_];
+    }
+
+  private:
+    // Set on the middle index when the writer has published into it.
+    static const int FRESH = 4;
+    static const int INDEX_MASK = 3;
+
+    T buffers_[NUM_BUFFERS];
+
+    // Each on its own cache line, so the two threads don't slow each
+    // other down when they don't even share anything.
+    alignas(64) int back_;            // Writer's.
+    alignas(64) std::atomic<int> middle_;
+    alignas(64) int front_;           // Reader's.
+};
+
+#endif /* triplebuffer_h */
@@ -0,0 +1,99 @@
+#ifndef wall_h
+#define wall_h
+
+#include "tile.h"
+
+// Which sprite a wall or gate tile is drawn with.
+typedef enum {
+  WALL_NONE,      // Not a wall, nothing to draw.
+  WALL_TOP_LEFT,  // Corners.
+  WALL_TOP_RIGHT,
+  WALL_BOT_LEFT,
+  WALL_BOT_RIGHT,
+  WALL_LEFT_RIGHT, // Edges.
+  WALL_TOP_BOT,
+  WALL_GATE
+} WallSprite;
+
+/**
+ * Is this tile drawn as part of a wall, for the purpose
+ * of joining up the wall sprites of the tiles around it?
+ */
+constexpr bool isWall(TileType tile)
+{
+  return (tile == TILE_WALL || tile == TILE_GATE);
+}
+
+/**
+ * Work out which sprite the tile at the center of the given 3x3 block
+ * of tiles should be drawn with, so that walls join up into corners and
+ * edges. Tiles outside the board should be passed in as TILE_WALL.
+ *
+ * Walls never change, so this only needs calling once per tile when
+ * a level is compiled. constexpr, so the default level's walls are
+ * worked out along with the rest of it when the game is built.
+ */
+constexpr WallSprite getWallSprite(TileType tile,
+                                   TileType topTile, TileType botTile,
+                                   TileType leftTile, TileType rightTile,
+                                   TileType topLeftTile, TileType topRightTile,
+                                   TileType botLeftTile, TileType botRightTile)
+{
+  if (tile == TILE_GATE) {
+    return WALL_GATE;
+  } else if (tile != TILE_WALL) {
+    return WALL_NONE;
+  }
+  
+  /* See if this wall should be drawn as one of the corner tiles. */
+  
+  if (isWall(botTile)) {
+    // Checking for Top-Left corner wall and Top-Right corner wall.
+    if (isWall(rightTile)) {
+      // Is a Top-Left corner wall candidate. Check if it should be.
+      if (!isWall(botRightTile)) {
+        return WALL_TOP_LEFT;
+      } else if (!isWall(topLeftTile) && !isWall(topTile) && !isWall(leftTile)) {
+        return WALL_TOP_LEFT;
+      }
+    }
+    if (isWall(leftTile)) {
+      // Is a Top-Right corner wall candidate. Check if it should be.
+      if (!isWall(botLeftTile)) {
+        return WALL_TOP_RIGHT;
+      } else if (!isWall(topRightTile) && !isWall(topTile) && !isWall(rightTile)) {
+        return WALL_TOP_RIGHT;
+      }
+    }
+  }
+  
+  if (isWall(topTile)) {
+    // Checking for Bot-Left corner wall and Bot-Right corner wall.
+    if (isWall(rightTile)) {
+      // Is a Bot-Left corner wall candidate. Check if it should be.
+      if (!isWall(topRightTile)) {
+        return WALL_BOT_LEFT;
+      } else if (!isWall(botLeftTile) && !isWall(botTile) && !isWall(leftTile)) {
+        return WALL_BOT_LEFT;
+      }
+    }
+    if (isWall(leftTile)) {
+      // Is a Bot-Right corner wall candidate. Check if it should be.
+      if (!isWall(topLeftTile)) {
+        return WALL_BOT_RIGHT;
+      } else if (!isWall(botRightTile) && !isWall(botTile) && !isWall(rightTile)) {
+        return WALL_BOT_RIGHT;
+      }
+    }
+  }
+  
+  /* Otherwise this wall should be drawn as one of the edge tiles. */
+  
+  if (!isWall(leftTile) || !isWall(rightTile)) {
+    return WALL_LEFT_RIGHT;
+  } else {
+    return WALL_TOP_BOT;
+  }
+}
+
+#endif /* wall_h */